@@ -0,0 +1,31 @@
+#pragma once
+
+namespace Bench
+{
+// Runs the callable for the given number of iterations and prints the average time per operation.
+// The callable returns a value that is accumulated, so the optimizer can't drop the work.
+template<typename F>
+void Measure(std::string_view aName, uint32_t aIterations, F&& aCallable, uint32_t aOpsPerIteration = 1)
+{
+    uint64_t sink = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < aIterations; ++i)
+    {
+        sink += static_cast<uint64_t>(aCallable(i));
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count() /
+                             (static_cast<double>(aIterations) * aOpsPerIteration);
+
+    std::printf("%-48.*s %12.1f ns/op  (%llu)\n", static_cast<int>(aName.size()), aName.data(), nanoseconds,
+                static_cast<unsigned long long>(sink));
+}
+
+void RunEntitySpatialIndex();
+void RunResourcePathPattern();
+void RunResourcePathTable();
+void RunSpdlogProvider();
+}
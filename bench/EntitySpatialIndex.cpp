@@ -0,0 +1,118 @@
+#include "Bench.hpp"
+#include "App/World/EntitySpatialIndex.hpp"
+
+namespace
+{
+constexpr uint32_t EntityCount = 10000;
+constexpr uint32_t QueriesPerFrame = 1000;
+constexpr uint32_t MovesPerFrame = 500;
+constexpr uint32_t Frames = 100;
+constexpr float WorldSize = 4000.0f;
+constexpr float QueryRadius = 50.0f;
+
+struct Entity
+{
+    Red::EntityID entityID;
+    Red::Vector4 position;
+};
+
+Red::Vector4 MakePosition(std::mt19937& aRng)
+{
+    std::uniform_real_distribution<float> planar(-WorldSize / 2, WorldSize / 2);
+    std::uniform_real_distribution<float> vertical(0.0f, 100.0f);
+
+    return {planar(aRng), planar(aRng), vertical(aRng), 1.0f};
+}
+}
+
+void Bench::RunEntitySpatialIndex()
+{
+    std::mt19937 rng(42);
+
+    // 10k entities spread over the playable area, as managed entities of a large mod setup
+    Core::Vector<Entity> entities;
+    entities.reserve(EntityCount);
+    for (uint32_t i = 0; i < EntityCount; ++i)
+    {
+        entities.push_back({Red::EntityID(0x1000000ull + i), MakePosition(rng)});
+    }
+
+    Core::Vector<Red::Vector4> centers;
+    centers.reserve(Frames * QueriesPerFrame);
+    for (uint32_t i = 0; i < Frames * QueriesPerFrame; ++i)
+    {
+        centers.push_back(MakePosition(rng));
+    }
+
+    // Scanning every entity is what proximity queries did before the grid
+    Measure("EntitySpatialIndex: linear scan, 1k radius/frame", Frames, [&](uint32_t aFrame) {
+        const auto radiusSq = QueryRadius * QueryRadius;
+        uint32_t found = 0;
+
+        for (uint32_t query = 0; query < QueriesPerFrame; ++query)
+        {
+            const auto& center = centers[aFrame * QueriesPerFrame + query];
+
+            for (const auto& entity : entities)
+            {
+                const auto dx = entity.position.X - center.X;
+                const auto dy = entity.position.Y - center.Y;
+                const auto dz = entity.position.Z - center.Z;
+
+                found += (dx * dx + dy * dy + dz * dz <= radiusSq);
+            }
+        }
+
+        return found;
+    });
+
+    App::EntitySpatialIndex index;
+
+    Measure("EntitySpatialIndex: 10k inserts", 1, [&](uint32_t) {
+        for (const auto& entity : entities)
+        {
+            index.Insert(entity.entityID, entity.position);
+        }
+
+        return index.GetSize();
+    }, EntityCount);
+
+    Measure("EntitySpatialIndex: grid, 1k radius/frame", Frames, [&](uint32_t aFrame) {
+        uint32_t found = 0;
+
+        for (uint32_t query = 0; query < QueriesPerFrame; ++query)
+        {
+            index.ForEachInRadius(centers[aFrame * QueriesPerFrame + query], QueryRadius,
+                                  [&found](Red::EntityID) { ++found; });
+        }
+
+        return found;
+    });
+
+    Measure("EntitySpatialIndex: grid, 1k nearest/frame", Frames, [&](uint32_t aFrame) {
+        uint32_t found = 0;
+
+        for (uint32_t query = 0; query < QueriesPerFrame; ++query)
+        {
+            const auto entityID = index.FindNearest(centers[aFrame * QueriesPerFrame + query], 0.0f,
+                                                    [](Red::EntityID) { return true; });
+            found += static_cast<bool>(entityID.hash);
+        }
+
+        return found;
+    });
+
+    // Streamed entities report new positions every frame, some of them cross cells
+    Measure("EntitySpatialIndex: grid, 500 moves/frame", Frames, [&](uint32_t aFrame) {
+        for (uint32_t move = 0; move < MovesPerFrame; ++move)
+        {
+            auto& entity = entities[(aFrame * MovesPerFrame + move) % EntityCount];
+            entity.position.X += 4.0f;
+            entity.position.Y -= 3.0f;
+
+            index.Insert(entity.entityID, entity.position);
+        }
+
+        return index.GetSize();
+    });
+}
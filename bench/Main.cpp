@@ -0,0 +1,21 @@
+#include "Bench.hpp"
+
+// Parts that depend on the running game are not covered here:
+// - CallbackSystem dispatch: handlers are script functions called through Red::CallSite,
+//   which needs the scripting runtime, and the system itself is created by the game instance.
+// - Function lookup cache behind CallVirtual: lookups walk CClass funcs and parents, and CClass
+//   instances are only constructed by the game's RTTI system, the calls then run script bytecode.
+// - TweakDBBatch: appends start from the flat value in the loaded TweakDB, and staged arrays are
+//   DynArrays that allocate through the engine allocator.
+// - QuestPhaseGraphAccessor: the phases it indexes are quest resources loaded from the game
+//   archives, and the node handles are engine objects typed through the game's RTTI.
+
+int main()
+{
+    Bench::RunEntitySpatialIndex();
+    Bench::RunResourcePathPattern();
+    Bench::RunResourcePathTable();
+    Bench::RunSpdlogProvider();
+
+    return 0;
+}
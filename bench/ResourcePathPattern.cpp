@@ -0,0 +1,69 @@
+#include "Bench.hpp"
+#include "App/Shared/ResourcePathPattern.hpp"
+
+namespace
+{
+constexpr uint32_t PatternCount = 256;
+constexpr uint32_t PathCount = 4096;
+constexpr uint32_t Iterations = 20000;
+
+std::string MakePrefix(uint32_t aIndex)
+{
+    return "base\\characters\\mods\\author_" + std::to_string(aIndex % 16) + "\\pack_" + std::to_string(aIndex) + "\\";
+}
+}
+
+void Bench::RunResourcePathPattern()
+{
+    std::mt19937 rng(42);
+
+    // Pure prefix patterns as registered by resource callbacks,
+    // a few of them with a suffix to keep the remainder check in the loop
+    Core::Vector<App::ResourcePathPattern> patterns;
+    for (uint32_t i = 0; i < PatternCount; ++i)
+    {
+        patterns.emplace_back(MakePrefix(i) + (i % 8 == 0 ? "*.mesh" : "*"));
+    }
+
+    // Mostly unrelated paths, with one in eight under one of the pattern prefixes
+    Core::Vector<std::string> paths;
+    for (uint32_t i = 0; i < PathCount; ++i)
+    {
+        if (rng() % 8 == 0)
+        {
+            paths.push_back(MakePrefix(rng() % PatternCount) + "item_" + std::to_string(i) + ".mesh");
+        }
+        else
+        {
+            paths.push_back("base\\environment\\props\\set_" + std::to_string(i) + "\\prop.ent");
+        }
+    }
+
+    Measure("ResourcePathPattern: per pattern prefix check", Iterations, [&](uint32_t aIteration) {
+        const auto& path = paths[aIteration % PathCount];
+        uint32_t matches = 0;
+
+        for (const auto& pattern : patterns)
+        {
+            matches += pattern.Matches(path);
+        }
+
+        return matches;
+    });
+
+    App::ResourcePathPattern::PrefixMatch prefixMatch;
+
+    Measure("ResourcePathPattern: shared prefix index", Iterations, [&](uint32_t aIteration) {
+        const auto& path = paths[aIteration % PathCount];
+        uint32_t matches = 0;
+
+        App::ResourcePathPattern::MatchPrefixes(path, prefixMatch);
+
+        for (const auto& pattern : patterns)
+        {
+            matches += pattern.Matches(path, prefixMatch);
+        }
+
+        return matches;
+    });
+}
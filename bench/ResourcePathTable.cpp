@@ -0,0 +1,206 @@
+#include "Bench.hpp"
+#include "App/Shared/ResourcePathTable.hpp"
+
+namespace
+{
+constexpr uint32_t PathCount = 400000;
+constexpr uint32_t WriterCount = 8;
+constexpr uint32_t CreateCallsPerWriter = 500000;
+
+std::atomic<size_t> s_allocatedBytes{0};
+
+// Counts heap usage of the baseline map, including strings that don't fit the small buffer
+template<typename T>
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(size_t aCount)
+    {
+        s_allocatedBytes += aCount * sizeof(T);
+        return std::allocator<T>().allocate(aCount);
+    }
+
+    void deallocate(T* aPtr, size_t aCount)
+    {
+        s_allocatedBytes -= aCount * sizeof(T);
+        std::allocator<T>().deallocate(aPtr, aCount);
+    }
+
+    template<typename U>
+    bool operator==(const CountingAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+};
+
+using CountedString = std::basic_string<char, std::char_traits<char>, CountingAllocator<char>>;
+
+// Layout of the registry before sharding: one map of heap strings behind a single lock,
+// taken exclusively by every insert
+struct MapRegistry
+{
+    MapRegistry()
+    {
+        map.reserve(PathCount);
+    }
+
+    std::string_view Find(uint64_t aHash)
+    {
+        std::shared_lock _(lock);
+        const auto& it = map.find(aHash);
+
+        if (it == map.end())
+            return {};
+
+        return it->second;
+    }
+
+    void Insert(uint64_t aHash, std::string_view aPathStr)
+    {
+        std::scoped_lock _(lock);
+        map[aHash] = CountedString(aPathStr);
+    }
+
+    Red::SharedSpinLock lock;
+    tsl::hopscotch_map<uint64_t, CountedString, std::hash<uint64_t>, std::equal_to<uint64_t>,
+                       CountingAllocator<std::pair<uint64_t, CountedString>>>
+        map;
+};
+
+struct PathItem
+{
+    uint64_t hash;
+    std::string str;
+};
+
+Core::Vector<PathItem> MakePaths()
+{
+    std::mt19937 rng(42);
+    Core::Vector<PathItem> paths;
+    paths.reserve(PathCount);
+
+    for (uint32_t i = 0; i < PathCount; ++i)
+    {
+        auto str = std::format("base\\environment\\architecture\\district_{}\\block_{}\\asset_{}_{}.mesh", rng() % 16,
+                               rng() % 512, i, rng() % 1000);
+        paths.push_back({RED4ext::FNV1a64(str.data()), std::move(str)});
+    }
+
+    return paths;
+}
+
+template<typename Registry>
+uint64_t RunWriters(Registry& aRegistry, const Core::Vector<PathItem>& aPaths)
+{
+    Core::Vector<std::thread> threads;
+    std::atomic<uint64_t> inserted{0};
+
+    // Every writer behaves like the ResourcePath::Create hook: most paths are known already,
+    // unknown ones are inserted, writers overlap on the same paths
+    for (uint32_t writer = 0; writer < WriterCount; ++writer)
+    {
+        threads.emplace_back([&, writer]() {
+            std::mt19937 rng(writer);
+            uint64_t writerInserted = 0;
+
+            for (uint32_t call = 0; call < CreateCallsPerWriter; ++call)
+            {
+                const auto& path = aPaths[rng() % aPaths.size()];
+
+                if (aRegistry.Find(path.hash).empty())
+                {
+                    aRegistry.Insert(path.hash, path.str);
+                    ++writerInserted;
+                }
+            }
+
+            inserted += writerInserted;
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return inserted;
+}
+}
+
+void Bench::RunResourcePathTable()
+{
+    const auto paths = MakePaths();
+
+    {
+        const auto baseBytes = s_allocatedBytes.load();
+        MapRegistry registry;
+
+        Measure("ResourcePathTable: map insert, 1 thread", 1, [&](uint32_t) {
+            for (const auto& path : paths)
+            {
+                registry.Insert(path.hash, path.str);
+            }
+            return registry.map.size();
+        }, PathCount);
+
+        Measure("ResourcePathTable: map lookup, 1 thread", 4, [&](uint32_t) {
+            size_t length = 0;
+            for (const auto& path : paths)
+            {
+                length += registry.Find(path.hash).size();
+            }
+            return length;
+        }, PathCount);
+
+        std::printf("%-48s %12.1f MiB\n", "ResourcePathTable: map memory, 400k paths",
+                    static_cast<double>(s_allocatedBytes - baseBytes) / (1024 * 1024));
+    }
+
+    {
+        App::ResourcePathTable table;
+
+        Measure("ResourcePathTable: table insert, 1 thread", 1, [&](uint32_t) {
+            for (const auto& path : paths)
+            {
+                table.Insert(path.hash, path.str);
+            }
+            return table.GetSize();
+        }, PathCount);
+
+        Measure("ResourcePathTable: table lookup, 1 thread", 4, [&](uint32_t) {
+            size_t length = 0;
+            for (const auto& path : paths)
+            {
+                length += table.Find(path.hash).size();
+            }
+            return length;
+        }, PathCount);
+
+        std::printf("%-48s %12.1f MiB\n", "ResourcePathTable: table memory, 400k paths",
+                    static_cast<double>(table.GetMemoryUsage()) / (1024 * 1024));
+    }
+
+    {
+        MapRegistry registry;
+
+        Measure(std::format("ResourcePathTable: map create hook, {} writers", WriterCount), 1, [&](uint32_t) {
+            return RunWriters(registry, paths);
+        }, WriterCount * CreateCallsPerWriter);
+    }
+
+    {
+        App::ResourcePathTable table;
+
+        Measure(std::format("ResourcePathTable: table create hook, {} writers", WriterCount), 1, [&](uint32_t) {
+            return RunWriters(table, paths);
+        }, WriterCount * CreateCallsPerWriter);
+    }
+}
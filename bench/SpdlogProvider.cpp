@@ -0,0 +1,79 @@
+#include "Bench.hpp"
+#include "Support/Spdlog/SpdlogProvider.hpp"
+
+namespace
+{
+constexpr uint32_t Iterations = 200000;
+constexpr uint32_t ThreadCount = 4;
+constexpr auto Message = std::string_view("[CallbackSystem] Dispatching Resource/PostLoad for base\\characters\\common\\"
+                                          "player_base_bodies\\player_female_average\\t0_000_pwa_base__full.mesh");
+
+class BenchProvider : public Support::SpdlogProvider
+{
+public:
+    using SpdlogProvider::OnShutdown;
+};
+
+std::filesystem::path GetLogPath(std::string_view aName)
+{
+    return std::filesystem::temp_directory_path() / std::format("CodewareBench-{}.log", aName);
+}
+
+void MeasureProvider(std::string_view aName, bool aAsync)
+{
+    BenchProvider provider;
+
+    if (aAsync)
+    {
+        provider.SetLogPath(GetLogPath(aName))->EnableAsyncLogging();
+    }
+    else
+    {
+        provider.SetLogPath(GetLogPath(aName));
+    }
+
+    Bench::Measure(std::format("SpdlogProvider: {} info, 1 thread", aName), Iterations, [&](uint32_t) {
+        provider.LogInfo(Message);
+        return 1;
+    });
+
+    // Several writers at once, as with jobs logging while the main thread does
+    Bench::Measure(std::format("SpdlogProvider: {} info, {} threads", aName, ThreadCount), 1, [&](uint32_t) {
+        Core::Vector<std::thread> threads;
+
+        for (uint32_t i = 0; i < ThreadCount; ++i)
+        {
+            threads.emplace_back([&]() {
+                for (uint32_t j = 0; j < Iterations / ThreadCount; ++j)
+                {
+                    provider.LogInfo(Message);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        return Iterations;
+    }, Iterations);
+
+    Bench::Measure(std::format("SpdlogProvider: {} debug, 1 thread", aName), Iterations, [&](uint32_t) {
+        provider.LogDebug(Message);
+        return 1;
+    });
+
+    // Time for the writer to catch up, paid by whoever waits for the log on shutdown
+    Bench::Measure(std::format("SpdlogProvider: {} shutdown", aName), 1, [&](uint32_t) {
+        provider.OnShutdown();
+        return provider.GetDroppedCount();
+    });
+}
+}
+
+void Bench::RunSpdlogProvider()
+{
+    MeasureProvider("sync", false);
+    MeasureProvider("async", true);
+}
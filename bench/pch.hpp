@@ -0,0 +1,38 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <regex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <RED4ext/Hashing/FNV1a.hpp>
+#include <RED4ext/RED4ext.hpp>
+
+#include <RED4ext/Scripting/Natives/Generated/Vector4.hpp>
+
+#include <nameof.hpp>
+
+#include "Core/Stl.hpp"
+#include "Core/Win.hpp"
+#include "Red/Alias.hpp"
+#include "Red/Specializations.hpp"
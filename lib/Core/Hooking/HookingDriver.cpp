@@ -20,3 +20,39 @@ Core::HookingDriver& Core::HookingDriver::GetDefault()
     assert(s_default);
     return *s_default;
 }
+
+void Core::HookingDriver::BeginTransaction()
+{
+}
+
+bool Core::HookingDriver::CommitTransaction()
+{
+    return true;
+}
+
+uint32_t Core::HookingDriver::GetFreezeCount()
+{
+    return 0;
+}
+
+Core::HookingTransaction::HookingTransaction(Core::HookingDriver& aDriver)
+    : m_driver(&aDriver)
+{
+    m_driver->BeginTransaction();
+}
+
+Core::HookingTransaction::~HookingTransaction()
+{
+    Commit();
+}
+
+bool Core::HookingTransaction::Commit()
+{
+    if (!m_driver)
+        return true;
+
+    auto driver = m_driver;
+    m_driver = nullptr;
+
+    return driver->CommitTransaction();
+}
@@ -9,7 +9,28 @@ public:
     virtual bool HookAttach(uintptr_t aAddress, void* aCallback, void** aOriginal) = 0;
     virtual bool HookDetach(uintptr_t aAddress) = 0;
 
+    // Hooks attached inside a transaction are created immediately,
+    // but only become active when the outermost transaction is committed.
+    virtual void BeginTransaction();
+    virtual bool CommitTransaction();
+    virtual uint32_t GetFreezeCount();
+
     static void SetDefault(HookingDriver& aDriver);
     static HookingDriver& GetDefault();
 };
+
+class HookingTransaction
+{
+public:
+    explicit HookingTransaction(HookingDriver& aDriver = HookingDriver::GetDefault());
+    ~HookingTransaction();
+
+    HookingTransaction(const HookingTransaction&) = delete;
+    HookingTransaction& operator=(const HookingTransaction&) = delete;
+
+    bool Commit();
+
+private:
+    HookingDriver* m_driver;
+};
 }
@@ -2,6 +2,7 @@
 
 #include "TypeInfo/Construction.hpp"
 #include "TypeInfo/Definition.hpp"
+#include "TypeInfo/Hierarchy.hpp"
 #include "TypeInfo/Properties.hpp"
 #include "TypeInfo/Parameters.hpp"
 #include "TypeInfo/Invocation.hpp"
@@ -0,0 +1,219 @@
+#pragma once
+
+#include "Registrar.hpp"
+
+namespace Red
+{
+namespace Detail
+{
+// Numbers every class in the type system in depth-first order, so that each class
+// owns the continuous range of numbers of its descendants.
+// Subclass checks then become two integer comparisons instead of a parent chain walk.
+// CClass has no spare field to hold the number, so the ranges live in an open addressing
+// table keyed by class pointer, a lookup is usually a single probe into one contiguous array.
+class ClassHierarchy
+{
+public:
+    static inline bool IsA(const CClass* aType, const CClass* aBase)
+    {
+        if (!aType || !aBase)
+            return false;
+
+        if (aType == aBase)
+            return true;
+
+        const auto& snapshot = GetSnapshot();
+
+        if (const auto* typeInterval = snapshot.Find(aType))
+        {
+            if (const auto* baseInterval = snapshot.Find(aBase))
+            {
+                return typeInterval->first >= baseInterval->first && typeInterval->first <= baseInterval->last;
+            }
+        }
+
+        // Classes created after the last numbering
+        for (auto type = aType->parent; type; type = type->parent)
+        {
+            if (type == aBase)
+                return true;
+        }
+
+        return false;
+    }
+
+    static inline void Invalidate()
+    {
+        ++s_invalidations;
+    }
+
+private:
+    struct Interval
+    {
+        uint32_t first;
+        uint32_t last;
+    };
+
+    struct Entry
+    {
+        const CClass* type;
+        Interval interval;
+    };
+
+    struct Snapshot
+    {
+        uint32_t generation;
+        uint32_t mask;
+        std::vector<Entry> entries;
+
+        [[nodiscard]] inline const Interval* Find(const CClass* aType) const
+        {
+            for (auto index = GetSlot(aType) & mask;; index = (index + 1) & mask)
+            {
+                const auto& entry = entries[index];
+
+                if (entry.type == aType)
+                    return &entry.interval;
+
+                if (!entry.type)
+                    return nullptr;
+            }
+        }
+
+        inline Interval& Insert(const CClass* aType)
+        {
+            auto index = GetSlot(aType) & mask;
+
+            while (entries[index].type && entries[index].type != aType)
+            {
+                index = (index + 1) & mask;
+            }
+
+            entries[index].type = aType;
+
+            return entries[index].interval;
+        }
+    };
+
+    using SnapshotPtr = std::shared_ptr<const Snapshot>;
+
+    static inline uint32_t GetSlot(const CClass* aType)
+    {
+        return static_cast<uint32_t>((reinterpret_cast<uintptr_t>(aType) * 0x9E3779B97F4A7C15ull) >> 32);
+    }
+
+    static inline uint32_t GetGeneration()
+    {
+        return TypeInfoRegistrar::GetGeneration() + s_invalidations.load(std::memory_order_acquire);
+    }
+
+    // Each thread keeps a reference to the snapshot it uses, so the check itself doesn't touch shared state.
+    // A replaced snapshot is released once every thread that used it has switched to the new one.
+    static inline const Snapshot& GetSnapshot()
+    {
+        thread_local SnapshotPtr t_snapshot;
+
+        const auto generation = GetGeneration();
+
+        if (t_snapshot && t_snapshot->generation == generation)
+            return *t_snapshot;
+
+        std::unique_lock _(s_buildLock);
+
+        if (!s_current || s_current->generation != generation)
+        {
+            s_current = std::make_shared<const Snapshot>(Build(generation));
+        }
+
+        t_snapshot = s_current;
+
+        return *t_snapshot;
+    }
+
+    static inline Snapshot Build(uint32_t aGeneration)
+    {
+        std::vector<CClass*> classes;
+        std::unordered_map<const CClass*, std::vector<CClass*>> children;
+        uint32_t classCount = 0;
+
+        CRTTISystem::Get()->types.ForEach([&classes, &children, &classCount](CName, CBaseRTTIType* aType) {
+            if (aType->GetType() == ERTTIType::Class)
+            {
+                auto type = reinterpret_cast<CClass*>(aType);
+
+                if (type->parent)
+                {
+                    children[type->parent].push_back(type);
+                }
+                else
+                {
+                    classes.push_back(type);
+                }
+
+                ++classCount;
+            }
+        });
+
+        // Keep the table at most half full, so probe sequences stay short
+        uint32_t capacity = 16;
+        while (capacity < classCount * 2)
+        {
+            capacity <<= 1;
+        }
+
+        Snapshot snapshot{aGeneration, capacity - 1};
+        snapshot.entries.resize(capacity);
+
+        uint32_t counter = 0;
+        std::vector<std::pair<CClass*, bool>> pending;
+
+        for (auto root : classes)
+        {
+            pending.emplace_back(root, false);
+
+            while (!pending.empty())
+            {
+                auto [type, visited] = pending.back();
+                pending.pop_back();
+
+                if (visited)
+                {
+                    snapshot.Insert(type).last = counter - 1;
+                    continue;
+                }
+
+                snapshot.Insert(type) = {counter, counter};
+                ++counter;
+
+                pending.emplace_back(type, true);
+
+                const auto childrenIt = children.find(type);
+                if (childrenIt != children.end())
+                {
+                    for (auto child : childrenIt->second)
+                    {
+                        pending.emplace_back(child, false);
+                    }
+                }
+            }
+        }
+
+        return snapshot;
+    }
+
+    static inline std::mutex s_buildLock;
+    static inline SnapshotPtr s_current;
+    static inline std::atomic<uint32_t> s_invalidations;
+};
+}
+
+inline bool IsA(const CClass* aType, const CClass* aBase)
+{
+    return Detail::ClassHierarchy::IsA(aType, aBase);
+}
+
+inline void InvalidateClassHierarchy()
+{
+    Detail::ClassHierarchy::Invalidate();
+}
+}
@@ -20,13 +20,20 @@ inline UniversalRelocFunc<CallFunction_t> CallFunctionWithFrame(RED4ext::Detail:
 inline RelocFunc<CallFunction_t> CallFunctionWithFrame(RED4ext::Addresses::CBaseFunction_InternalExecute);
 #endif
 
+constexpr char NopOp = 0;
+constexpr char ParamOp = 27;
+constexpr char ParamEndOp = 38;
+constexpr auto PointerSize = sizeof(void*);
+
+inline IScriptable* GetDummyContext()
+{
+    static auto* s_dummyContext = reinterpret_cast<IScriptable*>(Red::GetClass("entEntity")->CreateInstance());
+    return s_dummyContext;
+}
+
 inline bool CallFunctionWithStack(Red::CStackFrame* aFrame, CBaseFunction* aFunc, CStack& aStack)
 {
-    constexpr auto NopOp = 0;
-    constexpr auto ParamOp = 27;
-    constexpr auto ParamEndOp = 38;
     constexpr auto MaxCodeSize = 264;
-    constexpr auto PointerSize = sizeof(void*);
 
     char code[MaxCodeSize];
     CStackFrame frame(nullptr, code);
@@ -66,10 +73,8 @@ inline bool CallFunctionWithStack(Red::CStackFrame* aFrame, CBaseFunction* aFunc
         frame.func = aFunc;
     }
 
-    static auto* s_dummyContext = reinterpret_cast<IScriptable*>(Red::GetClass("entEntity")->CreateInstance());
-
     return CallFunctionWithFrame(aFunc,
-                                 aStack.context18 ? aStack.context18 : s_dummyContext,
+                                 aStack.context18 ? aStack.context18 : GetDummyContext(),
                                  &frame,
                                  aStack.result ? aStack.result->value : nullptr,
                                  aStack.result ? aStack.result->type : nullptr);
@@ -163,11 +168,154 @@ inline bool CallFunctionWithArgs(Red::CStackFrame* aFrame, CBaseFunction* aFunc,
 }
 }
 
-inline CBaseFunction* GetFunction(CClass* aType, CName aName, bool aMember = true, bool aStatic = true)
+// Reusable call site for a function that is called many times.
+// The parameter opcodes are encoded once, each call only patches argument types and values
+// into a copy of the template, without any heap allocations.
+// Functions with more than MaxParams parameters are called through the generic path.
+class CallSite
+{
+public:
+    static constexpr uint32_t MaxParams = 8;
+
+    CallSite() = default;
+
+    explicit CallSite(CBaseFunction* aFunc)
+    {
+        if (!aFunc)
+            return;
+
+        m_func = aFunc;
+
+        if (!aFunc->flags.isStatic)
+        {
+            const auto& func = reinterpret_cast<CClassFunction*>(aFunc);
+
+            if (!Detail::IsFakeStatic(func->parent->name))
+            {
+                m_contextType = func->parent;
+            }
+        }
+
+        if (aFunc->params.size > MaxParams)
+            return;
+
+        auto* code = m_code.data();
+
+        for (uint32_t i = 0; i < aFunc->params.size; ++i)
+        {
+            *code = Detail::ParamOp;
+            ++code;
+
+            m_argOffsets[i] = static_cast<uint8_t>(code - m_code.data());
+            code += 2 * Detail::PointerSize;
+        }
+
+        *code = Detail::ParamEndOp;
+        ++code;
+
+        m_codeSize = static_cast<uint8_t>(code - m_code.data());
+    }
+
+    [[nodiscard]] inline CBaseFunction* GetFunction() const noexcept
+    {
+        return m_func;
+    }
+
+    [[nodiscard]] inline bool IsDefined() const noexcept
+    {
+        return m_func != nullptr;
+    }
+
+    template<typename... Args>
+    inline bool operator()(IScriptable* aContext, Args&&... aArgs) const
+    {
+        return Call(nullptr, aContext, std::forward<Args>(aArgs)...);
+    }
+
+    template<typename... Args>
+    bool Call(Red::CStackFrame* aFrame, IScriptable* aContext, Args&&... aArgs) const
+    {
+        constexpr auto ArgCount = sizeof...(Args);
+
+        if (!m_func)
+            return false;
+
+        if (m_codeSize == 0)
+            return Detail::CallFunctionWithArgs(aFrame, m_func, aContext, std::forward<Args>(aArgs)...);
+
+        const auto hasResult = m_func->returnType != nullptr;
+
+        if (m_func->params.size + (hasResult ? 1 : 0) != ArgCount)
+            return false;
+
+        if (m_contextType)
+        {
+            if (!aContext || !aContext->GetType()->IsA(m_contextType))
+                return false;
+        }
+        else if (!aContext)
+        {
+            aContext = Detail::GetDummyContext();
+        }
+
+        std::array<CStackType, ArgCount> args{CStackType(
+            ResolveType<Args>(),
+            const_cast<std::remove_cvref_t<Args>*>(std::is_null_pointer_v<Args> ? nullptr : &aArgs))...};
+
+        CStackType* result = nullptr;
+        CStackType* params = args.data();
+
+        if (hasResult)
+        {
+            result = params;
+            ++params;
+
+            if (!IsCompatible(result->type, m_func->returnType->type))
+                return false;
+        }
+
+        char code[sizeof(m_code)];
+        std::memcpy(code, m_code.data(), m_codeSize);
+
+        for (uint32_t i = 0; i < m_func->params.size; ++i)
+        {
+            const auto& param = m_func->params[i];
+            const auto& arg = params[i];
+
+            // Omitted optional parameters change the frame layout
+            if (!arg.value)
+                return Detail::CallFunctionWithArgs(aFrame, m_func, aContext, std::forward<Args>(aArgs)...);
+
+            if (!IsCompatible(param->type, arg.type, arg.value))
+                return false;
+
+            auto* slot = reinterpret_cast<void**>(code + m_argOffsets[i]);
+            slot[0] = arg.type;
+            slot[1] = arg.value;
+        }
+
+        CStackFrame frame(nullptr, code);
+        frame.func = aFrame ? aFrame->func : m_func;
+
+        return Detail::CallFunctionWithFrame(m_func, aContext, &frame, result ? result->value : nullptr,
+                                             result ? result->type : nullptr);
+    }
+
+private:
+    CBaseFunction* m_func{nullptr};
+    CClass* m_contextType{nullptr};
+    std::array<char, MaxParams * (1 + 2 * sizeof(void*)) + 1> m_code{};
+    std::array<uint8_t, MaxParams> m_argOffsets{};
+    uint8_t m_codeSize{0};
+};
+
+namespace Detail
+{
+inline CBaseFunction* FindFunction(CClass* aType, CName aName, bool aMember, bool aStatic)
 {
     if (aType)
     {
-        if (aMember || Detail::IsFakeStatic(aType->name))
+        if (aMember || IsFakeStatic(aType->name))
         {
             for (auto func : aType->funcs)
             {
@@ -191,13 +339,102 @@ inline CBaseFunction* GetFunction(CClass* aType, CName aName, bool aMember = tru
 
         if (aType->parent)
         {
-            return GetFunction(aType->parent, aName, aMember, aStatic);
+            return FindFunction(aType->parent, aName, aMember, aStatic);
         }
     }
 
     return nullptr;
 }
 
+class FunctionCache
+{
+public:
+    static inline CBaseFunction* Get(CClass* aType, CName aName, bool aMember, bool aStatic)
+    {
+        const Key key{aType, aName, static_cast<uint8_t>((aMember ? 1 : 0) | (aStatic ? 2 : 0))};
+        const auto generation = GetGeneration();
+
+        {
+            std::shared_lock _(s_lock);
+
+            if (s_generation == generation)
+            {
+                auto it = s_functions.find(key);
+                if (it != s_functions.end())
+                {
+                    return it->second;
+                }
+            }
+        }
+
+        auto func = FindFunction(aType, aName, aMember, aStatic);
+
+        {
+            std::unique_lock _(s_lock);
+
+            if (s_generation != generation)
+            {
+                s_functions.clear();
+                s_generation = generation;
+            }
+
+            s_functions.emplace(key, func);
+        }
+
+        return func;
+    }
+
+    static inline void Invalidate()
+    {
+        ++s_invalidations;
+    }
+
+private:
+    struct Key
+    {
+        CClass* type;
+        CName name;
+        uint8_t flags;
+
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& aKey) const noexcept
+        {
+            auto hash = static_cast<size_t>(reinterpret_cast<uintptr_t>(aKey.type)) * 0x9E3779B97F4A7C15ull;
+            hash ^= aKey.name.hash + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+            return hash ^ aKey.flags;
+        }
+    };
+
+    // Lookups are only valid until new types are described or scripts are reloaded
+    static inline uint32_t GetGeneration()
+    {
+        return TypeInfoRegistrar::GetGeneration() + s_invalidations.load(std::memory_order_acquire);
+    }
+
+    static inline std::shared_mutex s_lock;
+    static inline std::unordered_map<Key, CBaseFunction*, KeyHash> s_functions;
+    static inline uint32_t s_generation;
+    static inline std::atomic<uint32_t> s_invalidations;
+};
+}
+
+inline CBaseFunction* GetFunction(CClass* aType, CName aName, bool aMember = true, bool aStatic = true)
+{
+    if (!aType)
+        return nullptr;
+
+    return Detail::FunctionCache::Get(aType, aName, aMember, aStatic);
+}
+
+inline void InvalidateFunctionCache()
+{
+    Detail::FunctionCache::Invalidate();
+}
+
 inline CBaseFunction* GetFunction(CName aType, CName aName, bool aMember = true, bool aStatic = true)
 {
     return GetFunction(GetClass(aType), aName, aMember, aStatic);
@@ -35,6 +35,11 @@ public:
         }
     }
 
+    static inline uint32_t GetGeneration()
+    {
+        return s_generation.load(std::memory_order_acquire);
+    }
+
 private:
     static inline void QueuePendingRegisterCallbacks()
     {
@@ -74,15 +79,18 @@ private:
     {
         ProcessPendingRegisterCallbacks();
         QueuePendingRegisterCallbacks();
+        ++s_generation;
     }
 
     static inline void OnDescribe()
     {
         ProcessPendingDescriberCallbacks();
         QueuePendingDescribeCallbacks();
+        ++s_generation;
     }
 
     static inline std::vector<Callback> s_registerCallbacks;
     static inline std::vector<Callback> s_describeCallbacks;
+    static inline std::atomic<uint32_t> s_generation;
 };
 }
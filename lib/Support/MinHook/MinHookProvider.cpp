@@ -2,7 +2,16 @@
 
 #include <MinHook.h>
 
+namespace
+{
+// Transactions belong to the thread that opened them, so hooks attached by other threads
+// in the meantime are enabled right away instead of waiting for an unrelated commit
+thread_local uint32_t t_transactionDepth = 0;
+thread_local uint32_t t_queuedCount = 0;
+}
+
 Support::MinHookProvider::MinHookProvider()
+    : m_freezeCount(0)
 {
     MH_Initialize();
 
@@ -25,6 +34,20 @@ bool Support::MinHookProvider::HookAttach(uintptr_t aAddress, void* aCallback, v
     if (MH_CreateHook(reinterpret_cast<void*>(aAddress), aCallback, aOriginal) != MH_OK)
         return false;
 
+    if (t_transactionDepth > 0)
+    {
+        if (MH_QueueEnableHook(reinterpret_cast<void*>(aAddress)) != MH_OK)
+        {
+            MH_RemoveHook(reinterpret_cast<void*>(aAddress));
+            return false;
+        }
+
+        ++t_queuedCount;
+        return true;
+    }
+
+    ++m_freezeCount;
+
     if (MH_EnableHook(reinterpret_cast<void*>(aAddress)) != MH_OK)
     {
         MH_RemoveHook(reinterpret_cast<void*>(aAddress));
@@ -36,7 +59,13 @@ bool Support::MinHookProvider::HookAttach(uintptr_t aAddress, void* aCallback, v
 
 bool Support::MinHookProvider::HookDetach(uintptr_t aAddress)
 {
-    if (MH_DisableHook(reinterpret_cast<void*>(aAddress)) != MH_OK)
+    // Detaching is never deferred, because the handler state is disposed right after the call,
+    // and the hook must not be reachable by then. A hook that is still waiting in the queue
+    // is reported as disabled and can be removed right away, which also drops the queued entry.
+    ++m_freezeCount;
+
+    const auto status = MH_DisableHook(reinterpret_cast<void*>(aAddress));
+    if (status != MH_OK && status != MH_ERROR_DISABLED)
         return false;
 
     if (MH_RemoveHook(reinterpret_cast<void*>(aAddress)) != MH_OK)
@@ -44,3 +73,31 @@ bool Support::MinHookProvider::HookDetach(uintptr_t aAddress)
 
     return true;
 }
+
+void Support::MinHookProvider::BeginTransaction()
+{
+    ++t_transactionDepth;
+}
+
+bool Support::MinHookProvider::CommitTransaction()
+{
+    if (t_transactionDepth == 0)
+        return false;
+
+    if (--t_transactionDepth > 0 || t_queuedCount == 0)
+        return true;
+
+    t_queuedCount = 0;
+
+    // The queue of MinHook is shared, so a commit also applies hooks queued by transactions
+    // still open on other threads, which only enables them earlier than their own commit would
+    std::unique_lock _(m_transactionLock);
+    ++m_freezeCount;
+
+    return MH_ApplyQueued() == MH_OK;
+}
+
+uint32_t Support::MinHookProvider::GetFreezeCount()
+{
+    return m_freezeCount;
+}
@@ -16,5 +16,13 @@ public:
     bool HookAttach(uintptr_t aAddress, void* aCallback) override;
     bool HookAttach(uintptr_t aAddress, void* aCallback, void** aOriginal) override;
     bool HookDetach(uintptr_t aAddress) override;
+
+    void BeginTransaction() override;
+    bool CommitTransaction() override;
+    uint32_t GetFreezeCount() override;
+
+private:
+    std::mutex m_transactionLock;
+    std::atomic<uint32_t> m_freezeCount;
 };
 }
@@ -2,9 +2,29 @@
 #include "Core/Facades/Runtime.hpp"
 #include "Core/Stl.hpp"
 
+#include <spdlog/async.h>
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/basic_file_sink.h>
 
+namespace
+{
+constexpr auto AsyncThreadCount = 1;
+constexpr auto CongestionThreshold = 0.75;
+constexpr auto CongestionSampleInterval = 64u;
+constexpr auto ShutdownDrainTimeout = std::chrono::seconds(2);
+}
+
+Support::SpdlogProvider::~SpdlogProvider()
+{
+    // Features are destroyed only after all of them are shut down,
+    // so nothing can hold the logger anymore when the writer thread is joined
+    if (m_logger)
+    {
+        m_logger->flush();
+        spdlog::shutdown();
+    }
+}
+
 void Support::SpdlogProvider::OnInitialize()
 {
     if (m_baseLogPath.empty())
@@ -64,13 +84,35 @@ void Support::SpdlogProvider::OnInitialize()
     }
 
     auto sink = Core::MakeShared<spdlog::sinks::basic_file_sink_mt>(logPath.string(), true);
-    auto logger = Core::MakeShared<spdlog::logger>("", spdlog::sinks_init_list{sink});
-    logger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%t] [%l] %v");
-    logger->flush_on(spdlog::level::trace);
 
-    spdlog::set_default_logger(logger);
+    if (m_asyncQueueSize > 0)
+    {
+        // The writer thread appends messages to the buffered file stream as they come,
+        // so the disk is only hit when the buffer is full or when a flush is requested
+        auto overflowPolicy = m_overflowPolicy == LogOverflowPolicy::Drop
+                                  ? spdlog::async_overflow_policy::overrun_oldest
+                                  : spdlog::async_overflow_policy::block;
+
+        m_threadPool = Core::MakeShared<spdlog::details::thread_pool>(m_asyncQueueSize, AsyncThreadCount);
+        m_logger = Core::MakeShared<spdlog::async_logger>("", sink, m_threadPool, overflowPolicy);
+        m_logger->flush_on(spdlog::level::err);
+    }
+    else
+    {
+        m_logger = Core::MakeShared<spdlog::logger>("", sink);
+        m_logger->flush_on(spdlog::level::trace);
+    }
+
+    m_logger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%t] [%l] %v");
+
+    spdlog::set_default_logger(m_logger);
     spdlog::set_level(spdlog::level::trace);
 
+    if (m_threadPool && m_flushInterval.count() > 0)
+    {
+        spdlog::flush_every(m_flushInterval);
+    }
+
     if (m_recentSymlink && logPath != m_baseLogPath)
     {
         std::error_code error;
@@ -98,6 +140,12 @@ void Support::SpdlogProvider::LogError(const std::string_view& aMessage)
 
 void Support::SpdlogProvider::LogDebug(const std::string_view& aMessage)
 {
+    if (m_overflowPolicy == LogOverflowPolicy::DropDebugFirst && IsQueueCongested())
+    {
+        ++m_droppedDebug;
+        return;
+    }
+
     spdlog::default_logger_raw()->debug(aMessage);
 }
 
@@ -105,3 +153,49 @@ void Support::SpdlogProvider::LogFlush()
 {
     spdlog::default_logger_raw()->flush();
 }
+
+void Support::SpdlogProvider::OnShutdown()
+{
+    if (!m_threadPool)
+        return;
+
+    // Other features are shut down after this one and can still log from their threads,
+    // so the async logger stays alive until the provider is destroyed, only the queue is drained here.
+    // Flushing an async logger only enqueues a request, the writer thread is given a bounded time to catch up.
+    spdlog::flush_every(std::chrono::seconds::zero());
+    m_logger->flush();
+
+    const auto deadline = std::chrono::steady_clock::now() + ShutdownDrainTimeout;
+
+    while (m_threadPool->queue_size() > 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+bool Support::SpdlogProvider::IsQueueCongested()
+{
+    if (!m_threadPool)
+        return false;
+
+    // Reading the queue size takes the queue lock, so it's only sampled periodically
+    if (m_congestionSamples.fetch_add(1, std::memory_order_relaxed) % CongestionSampleInterval == 0)
+    {
+        m_congested.store(m_threadPool->queue_size() >= m_asyncQueueSize * CongestionThreshold,
+                          std::memory_order_relaxed);
+    }
+
+    return m_congested.load(std::memory_order_relaxed);
+}
+
+uint64_t Support::SpdlogProvider::GetDroppedCount() const
+{
+    auto droppedCount = m_droppedDebug.load();
+
+    if (m_threadPool)
+    {
+        droppedCount += m_threadPool->overrun_counter();
+    }
+
+    return droppedCount;
+}
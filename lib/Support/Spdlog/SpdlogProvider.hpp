@@ -3,13 +3,32 @@
 #include "Core/Foundation/Feature.hpp"
 #include "Core/Logging/LoggingDriver.hpp"
 
+namespace spdlog
+{
+class logger;
+
+namespace details
+{
+class thread_pool;
+}
+}
+
 namespace Support
 {
+enum class LogOverflowPolicy
+{
+    Block,
+    Drop,
+    DropDebugFirst,
+};
+
 class SpdlogProvider
     : public Core::Feature
     , public Core::LoggingDriver
 {
 public:
+    ~SpdlogProvider() override;
+
     void LogInfo(const std::string_view& aMessage) override;
     void LogWarning(const std::string_view& aMessage) override;
     void LogError(const std::string_view& aMessage) override;
@@ -40,12 +59,43 @@ public:
         return Defer(this);
     }
 
+    auto EnableAsyncLogging(uint32_t aQueueSize = 8192) noexcept
+    {
+        m_asyncQueueSize = aQueueSize;
+        return Defer(this);
+    }
+
+    auto SetOverflowPolicy(LogOverflowPolicy aPolicy) noexcept
+    {
+        m_overflowPolicy = aPolicy;
+        return Defer(this);
+    }
+
+    auto SetFlushInterval(std::chrono::seconds aInterval) noexcept
+    {
+        m_flushInterval = aInterval;
+        return Defer(this);
+    }
+
+    [[nodiscard]] uint64_t GetDroppedCount() const;
+
 protected:
     void OnInitialize() override;
+    void OnShutdown() override;
+
+    [[nodiscard]] bool IsQueueCongested();
 
     std::filesystem::path m_baseLogPath;
     bool m_appendTimestamp{ false };
     bool m_recentSymlink{ false };
     int32_t m_maxLogCount{ 10 };
+    uint32_t m_asyncQueueSize{ 0 };
+    LogOverflowPolicy m_overflowPolicy{ LogOverflowPolicy::DropDebugFirst };
+    std::chrono::seconds m_flushInterval{ 3 };
+    Core::SharedPtr<spdlog::details::thread_pool> m_threadPool;
+    Core::SharedPtr<spdlog::logger> m_logger;
+    std::atomic<uint64_t> m_droppedDebug{ 0 };
+    std::atomic<uint32_t> m_congestionSamples{ 0 };
+    std::atomic<bool> m_congested{ false };
 };
 }
@@ -26,6 +26,7 @@ App::Application::Application(HMODULE aHandle, const RED4ext::Sdk* aSdk)
 
     Register<Support::MinHookProvider>();
     Register<Support::SpdlogProvider>()
+        ->EnableAsyncLogging()
         ->AppendTimestampToLogName()
         ->CreateRecentLogSymlink();
     Register<Support::RED4extProvider>(aHandle, aSdk)
@@ -37,7 +38,7 @@ App::Application::Application(HMODULE aHandle, const RED4ext::Sdk* aSdk)
     Register<App::LocalizationService>();
     Register<App::PersistencyService>();
     Register<App::ResourcePathRegistry>(Env::KnownHashesPath());
-    Register<App::QuestPhaseRegistry>();
+    Register<App::QuestPhaseRegistry>(Env::ActivityCachePath());
     Register<App::OpenWorldTracker>();
     Register<App::WidgetBuildingService>();
     Register<App::WidgetSpawningService>();
@@ -49,9 +50,20 @@ void App::Application::OnStarting()
     LogInfo("{} {} is initializing...", Project::Name, Project::Version.to_string());
 
     Migration::CleanUp(Env::LegacyScriptsDir());
+
+    Core::HookingDriver::GetDefault().BeginTransaction();
 }
 
 void App::Application::OnStarted()
 {
+    auto& hookingDriver = Core::HookingDriver::GetDefault();
+
+    if (!hookingDriver.CommitTransaction())
+    {
+        LogError("Failed to enable hooks.");
+    }
+
+    LogDebug("Hooks enabled with {} thread suspensions.", hookingDriver.GetFreezeCount());
+
     LogInfo("{} is initialized.", Project::Name);
 }
@@ -71,22 +71,24 @@ void App::CallbackSystem::OnAfterWorldDetach()
 {
     m_restored = false;
 
-    std::unique_lock _(m_callbacksLock);
+    Core::Vector<Red::CName> events;
 
-    for (auto it = m_callbacksByEvent.begin(); it != m_callbacksByEvent.end(); ++it)
     {
-        auto& event = it.key();
-        auto& callbackList = it.value();
-
-        std::erase_if(callbackList, [](Red::Handle<CallbackSystemHandler>& aCallback) -> bool {
-            return !aCallback->IsSticky() || !aCallback->IsRegistered();
-        });
+        std::shared_lock _(m_callbacksLock);
+        events.reserve(m_callbacksByEvent.size());
 
-        if (callbackList.empty())
+        for (const auto& callbacksIt : m_callbacksByEvent)
         {
-            DeactivateEvent(event);
+            events.push_back(callbacksIt.first);
         }
     }
+
+    for (const auto& event : events)
+    {
+        RemoveCallbacks(event, [](const Red::Handle<CallbackSystemHandler>& aCallback) -> bool {
+            return !aCallback->IsSticky() || !aCallback->IsRegistered();
+        });
+    }
 }
 
 uint32_t App::CallbackSystem::OnBeforeGameSave(const Red::JobGroup& aJobGroup, void* a2)
@@ -148,10 +150,7 @@ Red::Handle<App::CallbackSystemHandler> App::CallbackSystem::RegisterCallback(
         handler->SetLifetime(CallbackLifetime::Forever);
     }
 
-    {
-        std::unique_lock _(m_callbacksLock);
-        m_callbacksByEvent[aEventName].push_back(handler);
-    }
+    AddCallback(aEventName, handler);
 
     return handler;
 }
@@ -171,10 +170,7 @@ Red::Handle<App::CallbackSystemHandler> App::CallbackSystem::RegisterStaticCallb
         handler->SetLifetime(CallbackLifetime::Forever);
     }
 
-    {
-        std::unique_lock _(m_callbacksLock);
-        m_callbacksByEvent[aEventName].push_back(handler);
-    }
+    AddCallback(aEventName, handler);
 
     return handler;
 }
@@ -184,30 +180,18 @@ void App::CallbackSystem::UnregisterCallback(Red::CName aEventName, const Red::H
 {
     MapEventName(aEventName);
 
-    std::unique_lock _(m_callbacksLock);
-    const auto& callbackListIt = m_callbacksByEvent.find(aEventName);
-
-    if (callbackListIt == m_callbacksByEvent.end())
-        return;
-
-    auto& callbackList = callbackListIt.value();
-
     if (aFunction.IsEmpty())
     {
-        std::erase_if(callbackList, [&aContext](Red::Handle<CallbackSystemHandler>& aHandler) -> bool {
+        RemoveCallbacks(aEventName, [&aContext](const Red::Handle<CallbackSystemHandler>& aHandler) -> bool {
             return aHandler->IsSameContext(aContext);
         });
     }
     else
     {
-        std::erase_if(callbackList, [&aContext, &aFunction](Red::Handle<CallbackSystemHandler>& aHandler) -> bool {
-            return aHandler->IsSameCallback(aContext, aFunction);
-        });
-    }
-
-    if (callbackList.empty())
-    {
-        DeactivateEvent(aEventName);
+        RemoveCallbacks(aEventName,
+                        [&aContext, &aFunction](const Red::Handle<CallbackSystemHandler>& aHandler) -> bool {
+                            return aHandler->IsSameCallback(aContext, aFunction);
+                        });
     }
 }
 
@@ -216,30 +200,18 @@ void App::CallbackSystem::UnregisterStaticCallback(Red::CName aEventName, Red::C
 {
     MapEventName(aEventName);
 
-    std::unique_lock _(m_callbacksLock);
-    const auto& callbackListIt = m_callbacksByEvent.find(aEventName);
-
-    if (callbackListIt == m_callbacksByEvent.end())
-        return;
-
-    auto& callbackList = callbackListIt.value();
-
     if (aFunction.IsEmpty())
     {
-        std::erase_if(callbackList, [&aContext](Red::Handle<CallbackSystemHandler>& aHandler) -> bool {
+        RemoveCallbacks(aEventName, [&aContext](const Red::Handle<CallbackSystemHandler>& aHandler) -> bool {
             return aHandler->IsSameContext(aContext);
         });
     }
     else
     {
-        std::erase_if(callbackList, [&aContext, &aFunction](Red::Handle<CallbackSystemHandler>& aHandler) -> bool {
-            return aHandler->IsSameCallback(aContext, aFunction);
-        });
-    }
-
-    if (callbackList.empty())
-    {
-        DeactivateEvent(aEventName);
+        RemoveCallbacks(aEventName,
+                        [&aContext, &aFunction](const Red::Handle<CallbackSystemHandler>& aHandler) -> bool {
+                            return aHandler->IsSameCallback(aContext, aFunction);
+                        });
     }
 }
 
@@ -272,21 +244,72 @@ void App::CallbackSystem::DeactivateEvent(Red::CName aEventName)
 
 void App::CallbackSystem::FireCallbacks(const Red::Handle<CallbackSystemEvent>& aEvent)
 {
-    Core::Vector<Red::Handle<CallbackSystemHandler>> callbacks;
+    const auto callbacks = GetCallbacks(aEvent->eventName);
+
+    if (!callbacks)
+        return;
+
+    FireCallbacks(callbacks, aEvent);
+}
+
+void App::CallbackSystem::FireCallbacks(const CallbackListPtr& aCallbacks,
+                                        const Red::Handle<CallbackSystemEvent>& aEvent)
+{
+    if (aCallbacks->handlers.size() < MinIndexedCallbacks)
     {
-        std::shared_lock _(m_callbacksLock);
-        const auto& callbacksIt = m_callbacksByEvent.find(aEvent->eventName);
+        for (const auto& callback : aCallbacks->handlers)
+        {
+            (*callback)(aEvent);
+        }
+        return;
+    }
 
-        if (callbacksIt == m_callbacksByEvent.end())
-            return;
+    // Read before building, so target changes made during the build
+    // leave the new index outdated instead of silently missing them
+    const auto targetsVersion = aCallbacks->targetsVersion->load();
 
-        callbacks = callbacksIt.value();
+    Core::SharedPtr<const CallbackSystemIndex> index;
+    {
+        std::shared_lock _(aCallbacks->indexLock);
+        index = aCallbacks->index;
     }
 
-    for (const auto& callback : callbacks)
+    if (!index || !index->IsActual(targetsVersion))
     {
-        (*callback)(aEvent);
+        index = Core::MakeShared<CallbackSystemIndex>(aCallbacks->handlers, targetsVersion);
+
+        std::unique_lock _(aCallbacks->indexLock);
+        aCallbacks->index = index;
+    }
+
+    index->ForEachCandidate(aCallbacks->handlers, aEvent,
+                            [&aEvent](const Red::Handle<CallbackSystemHandler>& aCallback) {
+                                (*aCallback)(aEvent);
+                            });
+}
+
+void App::CallbackSystem::AddCallback(Red::CName aEventName, const Red::Handle<CallbackSystemHandler>& aHandler)
+{
+    std::unique_lock _(m_callbacksLock);
+    auto& callbacksPtr = m_callbacksByEvent[aEventName];
+
+    auto callbacks = Core::MakeShared<CallbackList>();
+
+    if (callbacksPtr)
+    {
+        callbacks->handlers.reserve(callbacksPtr->handlers.size() + 1);
+        callbacks->handlers.assign(callbacksPtr->handlers.begin(), callbacksPtr->handlers.end());
+        callbacks->targetsVersion = callbacksPtr->targetsVersion;
     }
+    else
+    {
+        callbacks->targetsVersion = Core::MakeShared<CallbackSystemHandler::TargetsVersion>(0u);
+    }
+
+    // Target changes only invalidate the index of the event the handler belongs to
+    aHandler->BindTargetsVersion(callbacks->targetsVersion);
+    callbacks->handlers.push_back(aHandler);
+    callbacksPtr = std::move(callbacks);
 }
 
 bool App::CallbackSystem::RegisterEvent(Red::CName aEventName, Red::Optional<Red::CName> aEventType)
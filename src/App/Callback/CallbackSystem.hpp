@@ -3,6 +3,7 @@
 #include "App/Callback/CallbackSystemController.hpp"
 #include "App/Callback/CallbackSystemEvent.hpp"
 #include "App/Callback/CallbackSystemHandler.hpp"
+#include "App/Callback/CallbackSystemIndex.hpp"
 
 namespace App
 {
@@ -19,6 +20,18 @@ public:
     static constexpr auto SessionPauseEventName = Red::CName("Session/Pause");
     static constexpr auto SessionResumeEventName = Red::CName("Session/Resume");
 
+    static constexpr size_t MinIndexedCallbacks = 8;
+
+    struct CallbackList
+    {
+        Core::Vector<Red::Handle<CallbackSystemHandler>> handlers;
+        CallbackSystemHandler::TargetsVersionPtr targetsVersion;
+        mutable Red::SharedSpinLock indexLock;
+        mutable Core::SharedPtr<const CallbackSystemIndex> index;
+    };
+
+    using CallbackListPtr = Core::SharedPtr<const CallbackList>;
+
     CallbackSystem();
     ~CallbackSystem() override;
 
@@ -44,24 +57,14 @@ public:
     template<typename Event, typename... Args>
     inline bool DispatchNativeEvent(Red::CName aEventName, Args&&... aArgs)
     {
-        Core::Vector<Red::Handle<CallbackSystemHandler>> callbacks(0);
-
-        {
-            std::shared_lock _(m_callbacksLock);
-            const auto& callbacksIt = m_callbacksByEvent.find(aEventName);
+        const auto callbacks = GetCallbacks(aEventName);
 
-            if (callbacksIt == m_callbacksByEvent.end())
-                return false;
-
-            callbacks = callbacksIt.value();
-        }
+        if (!callbacks)
+            return false;
 
         const auto event = Red::MakeHandle<Event>(aEventName, std::forward<Args>(aArgs)...);
 
-        for (const auto& callback : callbacks)
-        {
-            (*callback)(event);
-        }
+        FireCallbacks(callbacks, event);
 
         return true;
     }
@@ -87,6 +90,53 @@ protected:
     void ActivateEvent(Red::CName aEventName);
     void DeactivateEvent(Red::CName aEventName);
     void FireCallbacks(const Red::Handle<CallbackSystemEvent>& aEvent);
+    void FireCallbacks(const CallbackListPtr& aCallbacks, const Red::Handle<CallbackSystemEvent>& aEvent);
+
+    void AddCallback(Red::CName aEventName, const Red::Handle<CallbackSystemHandler>& aHandler);
+
+    template<typename Predicate>
+    inline void RemoveCallbacks(Red::CName aEventName, Predicate&& aPredicate)
+    {
+        std::unique_lock _(m_callbacksLock);
+        const auto& callbacksIt = m_callbacksByEvent.find(aEventName);
+
+        if (callbacksIt == m_callbacksByEvent.end())
+            return;
+
+        // Dispatchers may still iterate the current snapshot,
+        // so the filtered list is published as a new one
+        auto callbacks = Core::MakeShared<CallbackList>();
+        callbacks->targetsVersion = callbacksIt.value()->targetsVersion;
+        std::ranges::copy_if(callbacksIt.value()->handlers, std::back_inserter(callbacks->handlers),
+                             [&aPredicate](const Red::Handle<CallbackSystemHandler>& aHandler) -> bool {
+                                 return !aPredicate(aHandler);
+                             });
+
+        if (callbacks->handlers.size() != callbacksIt.value()->handlers.size())
+        {
+            callbacksIt.value() = std::move(callbacks);
+        }
+
+        // Empty lists are kept, so dispatching still reports the event as known
+        if (callbacksIt.value()->handlers.empty())
+        {
+            DeactivateEvent(aEventName);
+        }
+    }
+
+    // The map lookup needs the read lock anyway, so the snapshot is returned as a shared pointer
+    // rather than a raw one with deferred reclamation, the refcount is one more atomic increment
+    // next to the one the lock already takes
+    inline CallbackListPtr GetCallbacks(Red::CName aEventName)
+    {
+        std::shared_lock _(m_callbacksLock);
+        const auto& callbacksIt = m_callbacksByEvent.find(aEventName);
+
+        if (callbacksIt == m_callbacksByEvent.end())
+            return {};
+
+        return callbacksIt.value();
+    }
 
     template<typename TController>
     inline void RegisterController()
@@ -109,7 +159,7 @@ protected:
     bool m_pregame;
 
     std::shared_mutex m_callbacksLock;
-    Core::Map<Red::CName, Core::Vector<Red::Handle<CallbackSystemHandler>>> m_callbacksByEvent;
+    Core::Map<Red::CName, CallbackListPtr> m_callbacksByEvent;
     Core::Map<Red::CName, Core::SharedPtr<CallbackSystemController>> m_eventControllers;
     Core::Map<Red::CName, Red::CName> m_supportedEvents;
     Core::Map<Red::CName, Red::CName> m_eventMappings;
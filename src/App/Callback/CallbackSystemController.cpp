@@ -1,4 +1,5 @@
 #include "CallbackSystemController.hpp"
+#include "Core/Hooking/HookingDriver.hpp"
 
 Core::Map<Red::CName, Red::CName> App::CallbackSystemController::GetMappings()
 {
@@ -9,6 +10,8 @@ bool App::CallbackSystemController::ActivateEvent(Red::CName aEvent)
 {
     if (!m_activeEvents.contains(aEvent))
     {
+        Core::HookingTransaction hookingTransaction;
+
         m_activeEvents.insert(aEvent);
         OnActivateEvent(aEvent);
 
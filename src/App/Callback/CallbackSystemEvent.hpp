@@ -2,6 +2,15 @@
 
 namespace App
 {
+enum class CallbackIndexKey : uint8_t
+{
+    EntityID,
+    RecordID,
+    TemplatePath,
+    ResourcePath,
+    Count,
+};
+
 struct CallbackSystemEvent : Red::IScriptable
 {
     CallbackSystemEvent() = default;
@@ -19,6 +28,13 @@ struct CallbackSystemEvent : Red::IScriptable
         }
     }
 
+    // Provides the value of the discriminating field used to preselect handlers.
+    // When the value is unknown for the event, all handlers indexed by this key are called.
+    virtual bool GetIndexKey(CallbackIndexKey aKey, uint64_t& aValue)
+    {
+        return false;
+    }
+
     Red::CName eventName;
 
     RTTI_IMPL_TYPEINFO(App::CallbackSystemEvent);
@@ -21,6 +21,9 @@ enum class CallbackLifetime
 struct CallbackSystemHandler : Red::IScriptable
 {
 public:
+    using TargetsVersion = std::atomic<uint32_t>;
+    using TargetsVersionPtr = Core::SharedPtr<TargetsVersion>;
+
     CallbackSystemHandler() = default;
 
     CallbackSystemHandler(Red::CName aEventType, Red::WeakHandle<Red::IScriptable> aContext, Red::CName aFunctionName)
@@ -28,6 +31,7 @@ public:
         , contextWeak(std::move(aContext))
         , functionName(aFunctionName)
         , function(Red::GetMemberFunction(contextWeak.Lock(), aFunctionName))
+        , callSite(function)
         , valid(function != nullptr)
     {
     }
@@ -37,6 +41,7 @@ public:
         , contextType(aContext)
         , functionName(aFunctionName)
         , function(Red::GetStaticFunction(contextType, aFunctionName))
+        , callSite(function)
         , valid(function != nullptr)
     {
     }
@@ -145,6 +150,7 @@ public:
             std::unique_lock _(stateLock);
             targets.push_back(aTarget);
             targeted = true;
+            BumpTargetsVersion();
         }
 
         return Red::AsHandle(this);
@@ -158,6 +164,7 @@ public:
             std::erase_if(targets, [&aTarget](const Red::Handle<CallbackSystemTarget>& aCandidate) -> bool {
                 return aCandidate->Equals(aTarget);
             });
+            BumpTargetsVersion();
         }
 
         return Red::AsHandle(this);
@@ -188,17 +195,52 @@ public:
         registered = false;
     }
 
+    bool GetIndexKeys(Core::Vector<std::pair<CallbackIndexKey, uint64_t>>& aKeys)
+    {
+        std::shared_lock _(stateLock);
+
+        if (!targeted)
+            return false;
+
+        for (const auto& target : targets)
+        {
+            CallbackIndexKey key;
+            uint64_t value;
+
+            if (!target->GetIndexKey(key, value))
+                return false;
+
+            aKeys.emplace_back(key, value);
+        }
+
+        return true;
+    }
+
+    void BindTargetsVersion(TargetsVersionPtr aVersion)
+    {
+        std::unique_lock _(stateLock);
+        targetsVersion = std::move(aVersion);
+    }
+
 private:
+    inline void BumpTargetsVersion()
+    {
+        if (targetsVersion)
+        {
+            ++*targetsVersion;
+        }
+    }
+
     [[nodiscard]] inline bool ExecuteCallback(const Red::Handle<CallbackSystemEvent>& aEvent) const
     {
         if (contextType)
         {
-            return Red::CallFunction(function, aEvent);
+            return callSite(nullptr, aEvent);
         }
 
         if (auto context = contextWeak.Lock())
         {
-            return Red::CallFunction(context, function, aEvent);
+            return callSite(context.GetPtr(), aEvent);
         }
 
         return false;
@@ -209,12 +251,14 @@ private:
     Red::CName contextType;
     Red::CName functionName;
     Red::CBaseFunction* function{nullptr};
+    Red::CallSite callSite;
 
     Red::SharedSpinLock stateLock;
     CallbackRunMode runMode{CallbackRunMode::Default};
     CallbackLifetime lifetime{CallbackLifetime::Session};
     Core::Vector<Red::Handle<CallbackSystemTarget>> targets;
     bool targeted{false};
+    TargetsVersionPtr targetsVersion;
 
     Red::SharedSpinLock callbackLock;
     bool registered{true};
@@ -0,0 +1,42 @@
+#include "CallbackSystemIndex.hpp"
+
+App::CallbackSystemIndex::CallbackSystemIndex(const HandlerList& aHandlers, uint32_t aTargetsVersion)
+    : m_version(aTargetsVersion)
+    , m_indexed(false)
+{
+    Core::Vector<std::pair<CallbackIndexKey, uint64_t>> keys;
+
+    for (uint32_t index = 0; index < aHandlers.size(); ++index)
+    {
+        keys.clear();
+
+        if (!aHandlers[index]->GetIndexKeys(keys))
+        {
+            AddToBucket(m_unindexed, index);
+            continue;
+        }
+
+        for (const auto& [key, value] : keys)
+        {
+            const auto keyIndex = static_cast<size_t>(key);
+
+            AddToBucket(m_byKey[keyIndex], index);
+            AddToBucket(m_byValue[keyIndex][value], index);
+        }
+
+        m_indexed = true;
+    }
+}
+
+bool App::CallbackSystemIndex::IsActual(uint32_t aTargetsVersion) const
+{
+    return m_version == aTargetsVersion;
+}
+
+void App::CallbackSystemIndex::AddToBucket(Bucket& aBucket, uint32_t aIndex)
+{
+    if (aBucket.empty() || aBucket.back() != aIndex)
+    {
+        aBucket.push_back(aIndex);
+    }
+}
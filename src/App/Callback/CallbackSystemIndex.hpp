@@ -0,0 +1,99 @@
+#pragma once
+
+#include "App/Callback/CallbackSystemEvent.hpp"
+#include "App/Callback/CallbackSystemHandler.hpp"
+
+namespace App
+{
+class CallbackSystemIndex
+{
+public:
+    using HandlerList = Core::Vector<Red::Handle<CallbackSystemHandler>>;
+
+    CallbackSystemIndex(const HandlerList& aHandlers, uint32_t aTargetsVersion);
+
+    [[nodiscard]] bool IsActual(uint32_t aTargetsVersion) const;
+
+    template<typename Callback>
+    inline void ForEachCandidate(const HandlerList& aHandlers, const Red::Handle<CallbackSystemEvent>& aEvent,
+                                 Callback&& aCallback) const
+    {
+        if (!m_indexed)
+        {
+            for (const auto& handler : aHandlers)
+            {
+                aCallback(handler);
+            }
+            return;
+        }
+
+        std::array<std::span<const uint32_t>, KeyCount + 1> lists;
+        size_t listCount = 0;
+
+        if (!m_unindexed.empty())
+        {
+            lists[listCount++] = m_unindexed;
+        }
+
+        for (size_t key = 0; key < KeyCount; ++key)
+        {
+            if (m_byKey[key].empty())
+                continue;
+
+            uint64_t value;
+            if (!aEvent->GetIndexKey(static_cast<CallbackIndexKey>(key), value))
+            {
+                lists[listCount++] = m_byKey[key];
+                continue;
+            }
+
+            const auto& bucketIt = m_byValue[key].find(value);
+            if (bucketIt != m_byValue[key].end())
+            {
+                lists[listCount++] = bucketIt.value();
+            }
+        }
+
+        // Each list is sorted by registration order, merging them
+        // keeps the dispatch order and calls every handler only once
+        while (true)
+        {
+            auto next = std::numeric_limits<uint32_t>::max();
+
+            for (size_t i = 0; i < listCount; ++i)
+            {
+                if (!lists[i].empty() && lists[i].front() < next)
+                {
+                    next = lists[i].front();
+                }
+            }
+
+            if (next == std::numeric_limits<uint32_t>::max())
+                break;
+
+            for (size_t i = 0; i < listCount; ++i)
+            {
+                if (!lists[i].empty() && lists[i].front() == next)
+                {
+                    lists[i] = lists[i].subspan(1);
+                }
+            }
+
+            aCallback(aHandlers[next]);
+        }
+    }
+
+private:
+    static constexpr auto KeyCount = static_cast<size_t>(CallbackIndexKey::Count);
+
+    using Bucket = Core::Vector<uint32_t>;
+
+    static void AddToBucket(Bucket& aBucket, uint32_t aIndex);
+
+    uint32_t m_version;
+    bool m_indexed;
+    Bucket m_unindexed;
+    std::array<Bucket, KeyCount> m_byKey;
+    std::array<Core::Map<uint64_t, Bucket>, KeyCount> m_byValue;
+};
+}
@@ -10,6 +10,13 @@ struct CallbackSystemTarget : Red::IScriptable
     virtual bool Equals(const Red::Handle<CallbackSystemTarget>& aTarget) = 0;
     virtual bool Supports(Red::CName aEventType) = 0;
 
+    // Provides the discriminating field that must match for this target to match.
+    // Targets that can't be reduced to a single key are checked for every event.
+    virtual bool GetIndexKey(CallbackIndexKey& aKey, uint64_t& aValue)
+    {
+        return false;
+    }
+
     RTTI_IMPL_TYPEINFO(App::CallbackSystemTarget);
     RTTI_IMPL_ALLOCATOR();
 };
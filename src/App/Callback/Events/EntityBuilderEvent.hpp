@@ -15,6 +15,32 @@ struct EntityBuilderEvent : CallbackSystemEvent
     {
     }
 
+    bool GetIndexKey(CallbackIndexKey aKey, uint64_t& aValue) override
+    {
+        auto* builder = entityBuilder->builder.instance;
+
+        switch (aKey)
+        {
+        case CallbackIndexKey::EntityID:
+            if (!builder->request)
+                return false;
+
+            aValue = builder->request->entityID.hash;
+            return true;
+        case CallbackIndexKey::RecordID:
+            if (!builder->request)
+                return false;
+
+            aValue = builder->request->recordID.value;
+            return true;
+        case CallbackIndexKey::TemplatePath:
+            aValue = builder->entityTemplate->path.hash;
+            return true;
+        default:
+            return false;
+        }
+    }
+
     Red::Handle<EntityBuilderWrapper> entityBuilder;
 
     RTTI_IMPL_TYPEINFO(App::EntityBuilderEvent);
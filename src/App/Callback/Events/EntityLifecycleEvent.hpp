@@ -14,6 +14,26 @@ struct EntityLifecycleEvent : CallbackSystemEvent
     {
     }
 
+    bool GetIndexKey(CallbackIndexKey aKey, uint64_t& aValue) override
+    {
+        auto* target = entity.instance;
+
+        if (!target)
+            return false;
+
+        switch (aKey)
+        {
+        case CallbackIndexKey::EntityID:
+            aValue = target->entityID.hash;
+            return true;
+        case CallbackIndexKey::TemplatePath:
+            aValue = target->templatePath.hash;
+            return true;
+        default:
+            return false;
+        }
+    }
+
     Red::WeakHandle<Red::Entity> entity;
 
     RTTI_IMPL_TYPEINFO(App::EntityLifecycleEvent);
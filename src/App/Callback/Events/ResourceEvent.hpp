@@ -19,6 +19,15 @@ struct ResourceEvent : CallbackSystemEvent
         return resource->path;
     }
 
+    bool GetIndexKey(CallbackIndexKey aKey, uint64_t& aValue) override
+    {
+        if (aKey != CallbackIndexKey::ResourcePath)
+            return false;
+
+        aValue = resource->path.hash;
+        return true;
+    }
+
     Red::Handle<Red::CResource> resource;
 
     RTTI_IMPL_TYPEINFO(App::ResourceEvent);
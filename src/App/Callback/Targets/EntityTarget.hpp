@@ -35,7 +35,7 @@ struct EntityTarget : CallbackSystemTarget
                 if (rootIndex < 0)
                     return false;
 
-                if (!builder->entityExtractor->results[rootIndex]->GetType()->IsA(entityType))
+                if (!Red::IsA(builder->entityExtractor->results[rootIndex]->GetType(), entityType))
                     return false;
             }
 
@@ -97,7 +97,7 @@ struct EntityTarget : CallbackSystemTarget
             if (entityID && entityID != entity->entityID)
                 return false;
 
-            if (entityType && !entity->GetType()->IsA(entityType))
+            if (entityType && !Red::IsA(entity->GetType(), entityType))
                 return false;
 
             if (templatePath && templatePath != entity->templatePath)
@@ -161,6 +161,32 @@ struct EntityTarget : CallbackSystemTarget
                aEventType == Red::GetTypeName<VehicleLightControlEvent>();
     }
 
+    bool GetIndexKey(CallbackIndexKey& aKey, uint64_t& aValue) override
+    {
+        if (entityID)
+        {
+            aKey = CallbackIndexKey::EntityID;
+            aValue = entityID.hash;
+            return true;
+        }
+
+        if (templatePath)
+        {
+            aKey = CallbackIndexKey::TemplatePath;
+            aValue = templatePath.hash;
+            return true;
+        }
+
+        if (recordID)
+        {
+            aKey = CallbackIndexKey::RecordID;
+            aValue = recordID.value;
+            return true;
+        }
+
+        return false;
+    }
+
     static Red::Handle<EntityTarget> ID(Red::EntityID aEntityID)
     {
         auto target = Red::MakeHandle<EntityTarget>();
@@ -27,13 +27,9 @@ struct ResourceTarget : CallbackSystemTarget
 
         if (path)
         {
-            if (regex.has_value())
+            if (pattern.IsDefined())
             {
-                auto pathStr = Core::Resolve<ResourcePathRegistry>()->ResolvePath(event->resource->path);
-                if (pathStr.empty())
-                    return false;
-
-                if (!std::regex_match(pathStr.begin(), pathStr.end(), regex.value()))
+                if (!Core::Resolve<ResourcePathRegistry>()->MatchPath(event->resource->path, pattern))
                     return false;
             }
             else
@@ -43,7 +39,7 @@ struct ResourceTarget : CallbackSystemTarget
             }
         }
 
-        if (type && !event->resource->GetNativeType()->IsA(type))
+        if (type && !Red::IsA(event->resource->GetNativeType(), type))
             return false;
 
         return true;
@@ -61,26 +57,25 @@ struct ResourceTarget : CallbackSystemTarget
         return aEventType == Red::GetTypeName<ResourceEvent>();
     }
 
+    bool GetIndexKey(CallbackIndexKey& aKey, uint64_t& aValue) override
+    {
+        if (!path || pattern.IsDefined())
+            return false;
+
+        aKey = CallbackIndexKey::ResourcePath;
+        aValue = path.hash;
+        return true;
+    }
+
     static Red::Handle<ResourceTarget> Path(const Red::RaRef<>& aResourceRef)
     {
         auto target = Red::MakeHandle<ResourceTarget>();
         target->path = aResourceRef.path;
 
-        auto pattern = Core::Resolve<ResourcePathRegistry>()->ResolvePath(target->path);
-        if (!pattern.empty())
+        auto patternStr = Core::Resolve<ResourcePathRegistry>()->ResolvePath(target->path);
+        if (!patternStr.empty())
         {
-            if (pattern.starts_with("regex:"))
-            {
-                target->regex = {pattern.data() + 6, pattern.size() - 6};
-            }
-            else if (pattern.find('*') != std::string_view::npos)
-            {
-                static const std::regex regexWildcardMeta(R"([\.\^\$\-\+\(\)\[\]\{\}\|\?\\])");
-                static const std::regex regexWildcardStar("\\*");
-                pattern = std::regex_replace(pattern, regexWildcardMeta, "\\$&");
-                pattern = std::regex_replace(pattern, regexWildcardStar, ".*");
-                target->regex = "^" + pattern + "$";
-            }
+            target->pattern = ResourcePathPattern(patternStr);
         }
 
         return target;
@@ -95,7 +90,7 @@ struct ResourceTarget : CallbackSystemTarget
     }
 
     Red::ResourcePath path{};
-    std::optional<std::regex> regex{};
+    ResourcePathPattern pattern{};
     Red::CClass* type{};
 
     RTTI_IMPL_TYPEINFO(App::ResourceTarget);
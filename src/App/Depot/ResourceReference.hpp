@@ -109,7 +109,9 @@ struct ResourceScriptReferenceEx
 
     inline static Red::CString ToString(const Red::redResourceReferenceScriptToken& aReference)
     {
-        return Core::Resolve<ResourcePathRegistry>()->ResolvePath(aReference.resource.path);
+        // Resolved paths point into the shared path storage and aren't null-terminated
+        const auto path = Core::Resolve<ResourcePathRegistry>()->ResolvePath(aReference.resource.path);
+        return Red::CString(path.data(), static_cast<uint32_t>(path.size()));
     }
 };
 }
@@ -17,7 +17,7 @@ struct EntityEx : Red::Entity
         {
             for (const auto& component : Raw::Entity::ComponentsStorage::Ptr(this)->components)
             {
-                if (component->GetType()->IsA(type))
+                if (Red::IsA(component->GetType(), type))
                 {
                     return component;
                 }
@@ -14,6 +14,16 @@ inline std::filesystem::path PersistentDir()
     return Core::Runtime::GetModuleDir() / L"Persistent";
 }
 
+inline std::filesystem::path CacheDir()
+{
+    return Core::Runtime::GetModuleDir() / L"Cache";
+}
+
+inline std::filesystem::path ActivityCachePath()
+{
+    return CacheDir() / L"Activities.bin";
+}
+
 inline std::filesystem::path KnownHashesPath()
 {
     return Core::Runtime::GetModuleDir() / L"Data" / L"KnownHashes.txt";
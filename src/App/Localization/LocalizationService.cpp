@@ -15,38 +15,124 @@ void App::LocalizationService::OnLoadTexts(Red::Handle<Red::localizationPersiste
     if (language.IsNone())
         return;
 
+    auto overlay = GetOverlay(language);
+
+    if (!overlay || overlay->entries.size == 0)
+        return;
+
+    auto& finalTextEntries = aOnScreens->entries;
+    auto plan = GetMergePlan(*overlay, aPath, finalTextEntries);
+
+    ApplyMergePlan(*overlay, *plan, finalTextEntries);
+}
+
+App::LocalizationService::LanguageOverlayPtr App::LocalizationService::GetOverlay(Red::CName aLanguage)
+{
     auto providerBaseType = Red::GetClass<"Codeware.Localization.ModLocalizationProvider">();
 
     if (!providerBaseType)
-        return;
+        return {};
 
-    Red::DynArray<Red::CClass*> providerTypes;
-    Red::CRTTISystem::Get()->GetClasses(providerBaseType, providerTypes);
+    Red::DynArray<Red::CClass*> allProviderTypes;
+    Red::CRTTISystem::Get()->GetClasses(providerBaseType, allProviderTypes);
 
-    if (providerTypes.size == 0)
-        return;
+    Core::Vector<Red::CClass*> providerTypes;
+    providerTypes.reserve(allProviderTypes.size);
 
-    Red::DynArray<Red::localizationPersistenceOnScreenEntry> modTextEntries;
+    for (auto providerType : allProviderTypes)
+    {
+        if (!providerType->flags.isAbstract)
+        {
+            providerTypes.push_back(providerType);
+        }
+    }
+
+    if (providerTypes.empty())
+        return {};
 
-    for (auto providerType : providerTypes)
     {
-        if (providerType->flags.isAbstract)
-            continue;
+        std::shared_lock _(s_overlaysLock);
+        const auto& overlayIt = s_overlays.find(aLanguage);
+
+        if (overlayIt != s_overlays.end() && overlayIt.value()->providerTypes == providerTypes)
+            return overlayIt.value();
+    }
 
+    auto overlay = BuildOverlay(aLanguage, std::move(providerTypes));
+
+    {
+        std::unique_lock _(s_overlaysLock);
+        s_overlays.insert_or_assign(aLanguage, overlay);
+    }
+
+    return overlay;
+}
+
+App::LocalizationService::LanguageOverlayPtr App::LocalizationService::BuildOverlay(
+    Red::CName aLanguage, Core::Vector<Red::CClass*>&& aProviderTypes)
+{
+    auto overlay = Core::MakeShared<LanguageOverlay>();
+    overlay->providerTypes = std::move(aProviderTypes);
+
+    TextEntryList modTextEntries;
+
+    for (auto providerType : overlay->providerTypes)
+    {
         auto provider = Red::MakeScriptedHandle<Red::IScriptable>(providerType);
 
-        Red::CallVirtual(provider, "GetOnScreenEntries", language, modTextEntries);
+        Red::CallVirtual(provider, "GetOnScreenEntries", aLanguage, modTextEntries);
     }
 
-    if (modTextEntries.size == 0)
-        return;
+    overlay->entries.Reserve(modTextEntries.size);
+    overlay->keys.reserve(modTextEntries.size);
+
+    for (auto& textEntry : modTextEntries)
+    {
+        if (textEntry.secondaryKey.Length() == 0)
+            continue;
+
+        overlay->keys.emplace_back(Red::FNV1a32(textEntry.secondaryKey.c_str()),
+                                   Red::FNV1a64(textEntry.secondaryKey.c_str()));
+        overlay->entries.EmplaceBack(std::move(textEntry));
+    }
+
+    return overlay;
+}
+
+App::LocalizationService::MergePlanPtr App::LocalizationService::GetMergePlan(LanguageOverlay& aOverlay,
+                                                                              Red::ResourcePath aPath,
+                                                                              const TextEntryList& aBaseEntries)
+{
+    {
+        std::shared_lock _(aOverlay.plansLock);
+        const auto& planIt = aOverlay.plans.find(aPath.hash);
+
+        if (planIt != aOverlay.plans.end() && planIt.value()->baseSize == aBaseEntries.size)
+            return planIt.value();
+    }
+
+    auto plan = BuildMergePlan(aOverlay, aBaseEntries);
+
+    {
+        std::unique_lock _(aOverlay.plansLock);
+        aOverlay.plans.insert_or_assign(aPath.hash, plan);
+    }
+
+    return plan;
+}
+
+App::LocalizationService::MergePlanPtr App::LocalizationService::BuildMergePlan(const LanguageOverlay& aOverlay,
+                                                                                const TextEntryList& aBaseEntries)
+{
+    auto plan = Core::MakeShared<MergePlan>();
+    plan->baseSize = aBaseEntries.size;
 
-    auto& finalTextEntries = aOnScreens->entries;
     Core::Map<uint64_t, uint32_t> textEntryKeyMap;
+    textEntryKeyMap.reserve(aBaseEntries.size * 3 + aOverlay.entries.size * 2);
 
-    for (uint32_t i = 0; i < finalTextEntries.size; ++i)
+    for (uint32_t i = 0; i < aBaseEntries.size; ++i)
     {
-        auto& textEntry = finalTextEntries[i];
+        const auto& textEntry = aBaseEntries[i];
 
         textEntryKeyMap[textEntry.primaryKey] = i;
 
@@ -57,33 +143,68 @@ void App::LocalizationService::OnLoadTexts(Red::Handle<Red::localizationPersiste
         }
     }
 
-    for (auto& textEntry : modTextEntries)
-    {
-        if (textEntry.secondaryKey.Length() == 0)
-            continue;
+    // Later entries override earlier ones, so only the last patch for each base entry is kept
+    Core::Map<uint32_t, uint32_t> patchByIndex;
 
-        textEntry.primaryKey = Red::FNV1a32(textEntry.secondaryKey.c_str());
-        MergeTextEntry(finalTextEntries, textEntry, textEntryKeyMap);
+    for (uint32_t i = 0; i < aOverlay.entries.size; ++i)
+    {
+        const auto& textEntry = aOverlay.entries[i];
 
-        textEntry.primaryKey = Red::FNV1a64(textEntry.secondaryKey.c_str());
-        MergeTextEntry(finalTextEntries, textEntry, textEntryKeyMap);
+        for (const auto key : {aOverlay.keys[i].first, aOverlay.keys[i].second})
+        {
+            const auto& it = textEntryKeyMap.find(key);
+            if (it == textEntryKeyMap.end())
+            {
+                textEntryKeyMap.emplace(key, plan->baseSize + plan->appends.size);
+
+                auto appendedEntry = textEntry;
+                appendedEntry.primaryKey = key;
+                plan->appends.EmplaceBack(std::move(appendedEntry));
+            }
+            else if (it.value() < plan->baseSize)
+            {
+                patchByIndex.insert_or_assign(it.value(), i);
+            }
+            else
+            {
+                auto& appendedEntry = plan->appends[it.value() - plan->baseSize];
+                appendedEntry.femaleVariant = textEntry.femaleVariant;
+                appendedEntry.maleVariant = textEntry.maleVariant;
+            }
+        }
     }
+
+    plan->patches.assign(patchByIndex.begin(), patchByIndex.end());
+    std::ranges::sort(plan->patches);
+
+    return plan;
 }
 
-void App::LocalizationService::MergeTextEntry(Red::DynArray<Red::localizationPersistenceOnScreenEntry>& aFinalList,
-                                              Red::localizationPersistenceOnScreenEntry& aTextEntry,
-                                              Core::Map<uint64_t, uint32_t>& aTextEntryKeyMap)
+void App::LocalizationService::ApplyMergePlan(const LanguageOverlay& aOverlay, const MergePlan& aPlan,
+                                              TextEntryList& aEntries)
 {
-    const auto& it = aTextEntryKeyMap.find(aTextEntry.primaryKey);
-    if (it == aTextEntryKeyMap.end())
+    for (const auto& [index, entryIndex] : aPlan.patches)
     {
-        aTextEntryKeyMap.emplace(aTextEntry.primaryKey, aFinalList.size);
-        aFinalList.EmplaceBack(aTextEntry);
+        const auto& textEntry = aOverlay.entries[entryIndex];
+        auto& existingEntry = aEntries[index];
+
+        existingEntry.femaleVariant = textEntry.femaleVariant;
+        existingEntry.maleVariant = textEntry.maleVariant;
     }
-    else
+
+    if (aPlan.appends.size > 0)
     {
-        auto* existingEntry = aFinalList.Begin() + it.value();
-        existingEntry->femaleVariant = aTextEntry.femaleVariant;
-        existingEntry->maleVariant = aTextEntry.maleVariant;
+        aEntries.Reserve(aEntries.size + aPlan.appends.size);
+
+        for (const auto& textEntry : aPlan.appends)
+        {
+            aEntries.PushBack(textEntry);
+        }
     }
 }
+
+void App::LocalizationService::InvalidateOverlays()
+{
+    std::unique_lock _(s_overlaysLock);
+    s_overlays.clear();
+}
@@ -11,14 +11,50 @@ class LocalizationService
     , public Core::HookingAgent
     , public Core::LoggingAgent
 {
+public:
+    static void InvalidateOverlays();
+
 protected:
+    using TextEntry = Red::localizationPersistenceOnScreenEntry;
+    using TextEntryList = Red::DynArray<TextEntry>;
+
+    // Describes how to merge mod entries into a particular text resource:
+    // base entries to overwrite with variants of a mod entry, and new entries to append.
+    struct MergePlan
+    {
+        uint32_t baseSize;
+        Core::Vector<std::pair<uint32_t, uint32_t>> patches;
+        TextEntryList appends;
+    };
+
+    using MergePlanPtr = Core::SharedPtr<MergePlan>;
+
+    // Entries provided by mods for a particular language with prehashed keys.
+    // Built once per script load and shared by all text resources of the language.
+    struct LanguageOverlay
+    {
+        Core::Vector<Red::CClass*> providerTypes;
+        TextEntryList entries;
+        Core::Vector<std::pair<uint64_t, uint64_t>> keys;
+        Core::Map<uint64_t, MergePlanPtr> plans;
+        std::shared_mutex plansLock;
+    };
+
+    using LanguageOverlayPtr = Core::SharedPtr<LanguageOverlay>;
+
     void OnBootstrap() override;
 
     static void OnLoadTexts(Red::Handle<Red::localizationPersistenceOnScreenEntries>& aOnScreens,
                             Red::ResourcePath aPath);
 
-    static void MergeTextEntry(Red::DynArray<Red::localizationPersistenceOnScreenEntry>& aFinalList,
-                               Red::localizationPersistenceOnScreenEntry& aTextEntry,
-                               Core::Map<uint64_t, uint32_t>& aTextEntryKeyMap);
+    static LanguageOverlayPtr GetOverlay(Red::CName aLanguage);
+    static LanguageOverlayPtr BuildOverlay(Red::CName aLanguage, Core::Vector<Red::CClass*>&& aProviderTypes);
+    static MergePlanPtr GetMergePlan(LanguageOverlay& aOverlay, Red::ResourcePath aPath,
+                                     const TextEntryList& aBaseEntries);
+    static MergePlanPtr BuildMergePlan(const LanguageOverlay& aOverlay, const TextEntryList& aBaseEntries);
+    static void ApplyMergePlan(const LanguageOverlay& aOverlay, const MergePlan& aPlan, TextEntryList& aEntries);
+
+    inline static std::shared_mutex s_overlaysLock;
+    inline static Core::Map<Red::CName, LanguageOverlayPtr> s_overlays;
 };
 }
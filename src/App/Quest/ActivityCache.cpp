@@ -0,0 +1,364 @@
+#include "ActivityCache.hpp"
+#include "Red/Serialization.hpp"
+
+namespace
+{
+class CacheWriter
+{
+public:
+    explicit CacheWriter(std::ofstream& aOut)
+        : m_out(aOut)
+    {
+    }
+
+    template<typename T>
+    requires std::is_trivially_copyable_v<T>
+    void Write(const T& aValue)
+    {
+        m_out.write(reinterpret_cast<const char*>(&aValue), sizeof(T));
+    }
+
+    template<typename T>
+    requires std::is_trivially_copyable_v<T>
+    void WriteArray(const Core::Vector<T>& aValues)
+    {
+        Write(static_cast<uint32_t>(aValues.size()));
+        m_out.write(reinterpret_cast<const char*>(aValues.data()), aValues.size() * sizeof(T));
+    }
+
+    void WriteString(std::string_view aValue)
+    {
+        Write(static_cast<uint32_t>(aValue.size()));
+        m_out.write(aValue.data(), aValue.size());
+    }
+
+    void WriteName(Red::CName aName)
+    {
+        WriteString(aName ? aName.ToString() : "");
+    }
+
+    void WriteBuffer(const Red::DataBuffer& aBuffer)
+    {
+        Write(aBuffer.buffer.size);
+        Write(aBuffer.buffer.alignment);
+        m_out.write(reinterpret_cast<const char*>(aBuffer.buffer.data), aBuffer.buffer.size);
+    }
+
+private:
+    std::ofstream& m_out;
+};
+
+class CacheReader
+{
+public:
+    CacheReader(const char* aData, size_t aSize)
+        : m_data(aData)
+        , m_size(aSize)
+        , m_offset(0)
+    {
+    }
+
+    template<typename T>
+    requires std::is_trivially_copyable_v<T>
+    bool Read(T& aValue)
+    {
+        if (m_size - m_offset < sizeof(T))
+            return false;
+
+        std::memcpy(&aValue, m_data + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+
+        return true;
+    }
+
+    template<typename T>
+    requires std::is_trivially_copyable_v<T>
+    bool ReadArray(Core::Vector<T>& aValues)
+    {
+        uint32_t count;
+        if (!Read(count) || (m_size - m_offset) / sizeof(T) < count)
+            return false;
+
+        aValues.resize(count);
+        std::memcpy(aValues.data(), m_data + m_offset, count * sizeof(T));
+        m_offset += count * sizeof(T);
+
+        return true;
+    }
+
+    bool ReadString(std::string& aValue)
+    {
+        uint32_t size;
+        if (!Read(size) || m_size - m_offset < size)
+            return false;
+
+        aValue.assign(m_data + m_offset, size);
+        m_offset += size;
+
+        return true;
+    }
+
+    bool ReadName(Red::CName& aName)
+    {
+        std::string name;
+        if (!ReadString(name))
+            return false;
+
+        aName = name.empty() ? Red::CName{} : Red::CNamePool::Add(name.c_str());
+
+        return true;
+    }
+
+    template<class T>
+    bool ReadObject(Red::Handle<T>& aObject)
+    {
+        uint32_t size;
+        uint32_t alignment;
+        if (!Read(size) || !Read(alignment) || m_size - m_offset < size)
+            return false;
+
+        Red::ObjectSerializer::ReadFromMemory(aObject, m_data + m_offset, size, alignment);
+        m_offset += size;
+
+        return static_cast<bool>(aObject);
+    }
+
+    [[nodiscard]] bool IsEnd() const
+    {
+        return m_offset == m_size;
+    }
+
+private:
+    const char* m_data;
+    size_t m_size;
+    size_t m_offset;
+};
+
+bool ReadActivity(CacheReader& aReader, Core::SharedPtr<App::ActivityDefinition>& aActivity)
+{
+    auto activity = Core::MakeShared<App::ActivityDefinition>();
+
+    if (!aReader.ReadName(activity->name) || !aReader.ReadName(activity->kind) ||
+        !aReader.Read(activity->mappinHash))
+        return false;
+
+    if (!aReader.ReadArray(activity->lootItemIDs) || !aReader.Read(activity->lootContainerRef))
+        return false;
+
+    uint32_t communityCount;
+    if (!aReader.Read(communityCount))
+        return false;
+
+    for (uint32_t i = 0; i < communityCount; ++i)
+    {
+        auto& communityRef = activity->communityRefs.emplace_back();
+        if (!aReader.Read(communityRef.objectRef) || !aReader.ReadName(communityRef.entryName))
+            return false;
+    }
+
+    if (!aReader.ReadArray(activity->spawnerRefs) || !aReader.ReadArray(activity->namedFacts) ||
+        !aReader.ReadArray(activity->graphFacts) || !aReader.ReadArray(activity->journalHashes))
+        return false;
+
+    uint32_t persistenceCount;
+    if (!aReader.Read(persistenceCount))
+        return false;
+
+    for (uint32_t i = 0; i < persistenceCount; ++i)
+    {
+        auto& persistenceRef = activity->persistenceRefs.emplace_back();
+        if (!aReader.Read(persistenceRef.objectRef) || !aReader.ReadName(persistenceRef.componentName) ||
+            !aReader.ReadName(persistenceRef.persistentStateType))
+            return false;
+    }
+
+    uint32_t resetNodeCount;
+    if (!aReader.Read(resetNodeCount))
+        return false;
+
+    for (uint32_t i = 0; i < resetNodeCount; ++i)
+    {
+        Red::Handle<Red::questNodeDefinition> resetNode;
+        if (!aReader.ReadObject(resetNode))
+            return false;
+
+        activity->resetNodes.push_back(std::move(resetNode));
+    }
+
+    aActivity = std::move(activity);
+
+    return true;
+}
+
+bool WriteActivity(CacheWriter& aWriter, const Core::SharedPtr<App::ActivityDefinition>& aActivity)
+{
+    const auto& activity = aActivity;
+
+    aWriter.WriteName(activity->name);
+    aWriter.WriteName(activity->kind);
+    aWriter.Write(activity->mappinHash);
+
+    aWriter.WriteArray(activity->lootItemIDs);
+    aWriter.Write(activity->lootContainerRef);
+
+    aWriter.Write(static_cast<uint32_t>(activity->communityRefs.size()));
+    for (const auto& communityRef : activity->communityRefs)
+    {
+        aWriter.Write(communityRef.objectRef);
+        aWriter.WriteName(communityRef.entryName);
+    }
+
+    aWriter.WriteArray(activity->spawnerRefs);
+    aWriter.WriteArray(activity->namedFacts);
+    aWriter.WriteArray(activity->graphFacts);
+    aWriter.WriteArray(activity->journalHashes);
+
+    aWriter.Write(static_cast<uint32_t>(activity->persistenceRefs.size()));
+    for (const auto& persistenceRef : activity->persistenceRefs)
+    {
+        aWriter.Write(persistenceRef.objectRef);
+        aWriter.WriteName(persistenceRef.componentName);
+        aWriter.WriteName(persistenceRef.persistentStateType);
+    }
+
+    aWriter.Write(static_cast<uint32_t>(activity->resetNodes.size()));
+    for (const auto& resetNode : activity->resetNodes)
+    {
+        Red::DataBuffer buffer;
+        Red::ObjectSerializer::WriteToBuffer(resetNode, buffer);
+
+        if (buffer.buffer.size == 0)
+            return false;
+
+        aWriter.WriteBuffer(buffer);
+    }
+
+    return true;
+}
+
+bool ReadPhase(CacheReader& aReader, App::ActivityCache::PhaseEntry& aEntry)
+{
+    uint8_t hasActivity;
+    if (!aReader.Read(aEntry.phaseNodePathHash) || !aReader.Read(aEntry.contentHash) ||
+        !aReader.Read(aEntry.inputNodeID) || !aReader.Read(hasActivity))
+        return false;
+
+    if (hasActivity && !ReadActivity(aReader, aEntry.activity))
+        return false;
+
+    uint32_t factCount;
+    if (!aReader.Read(factCount))
+        return false;
+
+    for (uint32_t i = 0; i < factCount; ++i)
+    {
+        if (!aReader.ReadString(aEntry.factNames.emplace_back()))
+            return false;
+    }
+
+    return true;
+}
+
+bool WritePhase(CacheWriter& aWriter, const App::ActivityCache::PhaseEntry& aEntry)
+{
+    aWriter.Write(aEntry.phaseNodePathHash);
+    aWriter.Write(aEntry.contentHash);
+    aWriter.Write(aEntry.inputNodeID);
+    aWriter.Write(static_cast<uint8_t>(aEntry.activity ? 1 : 0));
+
+    if (aEntry.activity && !WriteActivity(aWriter, aEntry.activity))
+        return false;
+
+    aWriter.Write(static_cast<uint32_t>(aEntry.factNames.size()));
+
+    for (const auto& factName : aEntry.factNames)
+    {
+        aWriter.WriteString(factName);
+    }
+
+    return true;
+}
+}
+
+bool App::ActivityCache::Load(const std::filesystem::path& aPath, uint64_t aBuild, uint64_t aFingerprint,
+                              Core::Vector<PhaseEntry>& aPhases)
+{
+    try
+    {
+        std::ifstream in(aPath, std::ios::binary | std::ios::ate);
+
+        if (!in.is_open())
+            return false;
+
+        const auto fileSize = static_cast<std::streamoff>(in.tellg());
+
+        if (fileSize < static_cast<std::streamoff>(sizeof(Header)))
+            return false;
+
+        std::string data(static_cast<size_t>(fileSize), '\0');
+        in.seekg(0);
+        in.read(data.data(), static_cast<std::streamsize>(data.size()));
+
+        if (!in.good())
+            return false;
+
+        CacheReader reader(data.data(), data.size());
+
+        Header header{};
+        reader.Read(header);
+
+        if (header.magic != Magic || header.version != Version || header.build != aBuild ||
+            header.fingerprint != aFingerprint)
+            return false;
+
+        // Record counts come from the file, so nothing is preallocated based on them,
+        // a damaged count simply runs out of data and fails the read
+        aPhases.clear();
+
+        for (uint32_t i = 0; i < header.phaseCount; ++i)
+        {
+            if (!ReadPhase(reader, aPhases.emplace_back()))
+                return false;
+        }
+
+        return reader.IsEnd();
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+bool App::ActivityCache::Save(const std::filesystem::path& aPath, uint64_t aBuild, uint64_t aFingerprint,
+                              const Core::Vector<PhaseEntry>& aPhases)
+{
+    std::error_code error;
+    std::filesystem::create_directories(aPath.parent_path(), error);
+
+    auto tempPath = aPath;
+    tempPath += L".tmp";
+
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+
+        if (!out.is_open())
+            return false;
+
+        CacheWriter writer(out);
+
+        writer.Write(Header{Magic, Version, aBuild, aFingerprint, static_cast<uint32_t>(aPhases.size())});
+
+        for (const auto& phase : aPhases)
+        {
+            if (!WritePhase(writer, phase))
+                return false;
+        }
+
+        if (!out.good())
+            return false;
+    }
+
+    std::filesystem::rename(tempPath, aPath, error);
+
+    return !error;
+}
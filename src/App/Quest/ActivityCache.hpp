@@ -0,0 +1,42 @@
+#pragma once
+
+#include "App/Quest/QuestPhaseRegistry.hpp"
+
+namespace App
+{
+// Versioned snapshot of the activity data extracted from the open world quest phases.
+// The file consists of a header followed by one record per scanned phase.
+// Each record is keyed by the phase node path and a hash of the phase graph content,
+// so a record is only reused while the phase graph it was extracted from is unchanged.
+// Records only hold data derived from quest graphs, live pointers are rebound by the registry.
+class ActivityCache
+{
+public:
+    struct PhaseEntry
+    {
+        Red::QuestNodePathHash phaseNodePathHash;
+        uint64_t contentHash;
+        Red::QuestNodeID inputNodeID;
+        Core::SharedPtr<ActivityDefinition> activity;
+        Core::Vector<std::string> factNames;
+    };
+
+    static bool Load(const std::filesystem::path& aPath, uint64_t aBuild, uint64_t aFingerprint,
+                     Core::Vector<PhaseEntry>& aPhases);
+    static bool Save(const std::filesystem::path& aPath, uint64_t aBuild, uint64_t aFingerprint,
+                     const Core::Vector<PhaseEntry>& aPhases);
+
+private:
+    static constexpr uint32_t Magic = 0x43415051; // QPAC
+    static constexpr uint32_t Version = 3;
+
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t build;
+        uint64_t fingerprint;
+        uint32_t phaseCount;
+    };
+};
+}
@@ -4,6 +4,10 @@
 
 namespace App
 {
+// Read-only index of a phase graph built in a single pass.
+// Nodes are stored in contiguous per-type spans, along with the subtypes of node types,
+// spawn actions and conditions, so finders don't have to cast every node on every query.
+// The index is immutable after construction and can be shared between queries and threads.
 class QuestPhaseGraphAccessor
 {
 public:
@@ -11,292 +15,476 @@ public:
         : m_graph(aPhaseGraph)
     {
         CollectNodes(aPhaseGraph, aRecursive);
+
+        m_nodes.Build();
+        m_nodeTypes.Build();
+        m_spawnActions.Build();
+        m_pauseConditions.Build();
+        m_conditions.Build();
+    }
+
+    // Hash of the phase content: every property of every node and of the objects the nodes own,
+    // nested phases included, and the phase prefabs of the resource used by the reset nodes.
+    // Values are read through RTTI, so an override that only changes values changes the hash as well.
+    [[nodiscard]] inline static uint64_t ComputeContentHash(const Red::Handle<Red::questQuestPhaseResource>& aPhaseResource,
+                                                            const Red::Handle<Red::questGraphDefinition>& aPhaseGraph)
+    {
+        ContentHasher hasher;
+
+        if (aPhaseResource)
+        {
+            if (const auto* prefabsProp = aPhaseResource->GetType()->GetProperty("phasePrefabs"))
+            {
+                hasher.HashValue(prefabsProp->type, prefabsProp->GetValuePtr<void>(aPhaseResource.instance));
+            }
+        }
+
+        hasher.HashObject(aPhaseGraph.instance);
+
+        return hasher.hash;
     }
 
     template<class T>
-    inline Core::Vector<Red::Handle<T>>& GetNodesOfType()
+    [[nodiscard]] inline std::span<const Red::Handle<T>> GetNodesOfType() const
     {
-        return *reinterpret_cast<Core::Vector<Red::Handle<T>>*>(&m_nodesByType[Red::GetTypeName<T>()]);
+        return m_nodes.Get<T>();
     }
 
-    inline Red::Handle<Red::questInputNodeDefinition> FindInputNode()
+    template<class T>
+    [[nodiscard]] inline std::span<const Red::Handle<T>> GetNodeTypesOfType() const
     {
-        for (const auto& inputNode : GetNodesOfType<Red::questInputNodeDefinition>())
-        {
-            return inputNode;
-        }
+        return m_nodeTypes.Get<T>();
+    }
 
-        return {};
+    [[nodiscard]] inline Red::Handle<Red::questInputNodeDefinition> FindInputNode() const
+    {
+        const auto inputNodes = GetNodesOfType<Red::questInputNodeDefinition>();
+
+        if (inputNodes.empty())
+            return {};
+
+        return inputNodes.front();
     }
 
-    inline Red::Handle<Red::questJournalEntry_NodeType> FindPointOfInterestMappin()
+    [[nodiscard]] inline Red::Handle<Red::questJournalEntry_NodeType> FindPointOfInterestMappin() const
     {
-        for (const auto& node : GetNodesOfType<Red::questJournalNodeDefinition>())
+        for (const auto& nodeType : GetNodeTypesOfType<Red::questJournalEntry_NodeType>())
         {
-            if (const auto& nodeType = Red::Cast<Red::questJournalEntry_NodeType>(node->type))
+            if (nodeType->path->className == Red::GetTypeName<Red::gameJournalPointOfInterestMappin>())
             {
-                if (nodeType->path->className == Red::GetTypeName<Red::gameJournalPointOfInterestMappin>())
-                {
-                    return nodeType;
-                }
+                return nodeType;
             }
         }
 
         return {};
     }
 
-    inline Red::Handle<Red::questJournalChangeMappinPhase_NodeType> FindCompletedPointOfInterestMappin()
+    [[nodiscard]] inline Red::Handle<Red::questJournalChangeMappinPhase_NodeType> FindCompletedPointOfInterestMappin() const
     {
-        for (const auto& node : GetNodesOfType<Red::questJournalNodeDefinition>())
+        for (const auto& nodeType : GetNodeTypesOfType<Red::questJournalChangeMappinPhase_NodeType>())
         {
-            if (const auto& nodeType = Red::Cast<Red::questJournalChangeMappinPhase_NodeType>(node->type))
+            if (nodeType->path->className == Red::GetTypeName<Red::gameJournalPointOfInterestMappin>() &&
+                nodeType->phase == Red::gamedataMappinPhase::CompletedPhase)
             {
-                if (nodeType->path->className == Red::GetTypeName<Red::gameJournalPointOfInterestMappin>() &&
-                    nodeType->phase == Red::gamedataMappinPhase::CompletedPhase)
-                {
-                    return nodeType;
-                }
+                return nodeType;
             }
         }
 
         return {};
     }
 
-    inline Core::Vector<Red::Handle<Red::questCommunityTemplate_NodeType>> FindCommunities()
+    [[nodiscard]] inline Core::Vector<Red::questCommunityTemplate_NodeType*> FindCommunities() const
     {
-        Core::Vector<Red::Handle<Red::questCommunityTemplate_NodeType>> communities;
+        return FindActivatedSpawnActions<Red::questCommunityTemplate_NodeType>();
+    }
 
-        for (const auto& node : GetNodesOfType<Red::questSpawnManagerNodeDefinition>())
-        {
-            for (const auto& action : node->actions)
-            {
-                if (const auto& nodeType = Red::Cast<Red::questCommunityTemplate_NodeType>(action.type))
-                {
-                    if (nodeType->action == Red::populationSpawnerObjectCtrlAction::Activate ||
-                        nodeType->action == Red::populationSpawnerObjectCtrlAction::Reactivate)
-                    {
-                        communities.push_back(nodeType);
-                    }
-                }
-            }
-        }
+    [[nodiscard]] inline Core::Vector<Red::questSpawnSet_NodeType*> FindSpawnSets() const
+    {
+        return FindActivatedSpawnActions<Red::questSpawnSet_NodeType>();
+    }
 
-        return communities;
+    [[nodiscard]] inline Core::Vector<Red::questSpawner_NodeType*> FindSpawners() const
+    {
+        return FindActivatedSpawnActions<Red::questSpawner_NodeType>();
     }
 
-    inline Core::Vector<Red::Handle<Red::questSpawnSet_NodeType>> FindSpawnSets()
+    [[nodiscard]] inline std::span<const Red::Handle<Red::questSetVar_NodeType>> FindFactChanges() const
     {
-        Core::Vector<Red::Handle<Red::questSpawnSet_NodeType>> spawnSets;
+        return GetNodeTypesOfType<Red::questSetVar_NodeType>();
+    }
 
-        for (const auto& node : GetNodesOfType<Red::questSpawnManagerNodeDefinition>())
-        {
-            for (const auto& action : node->actions)
-            {
-                if (const auto& nodeType = Red::Cast<Red::questSpawnSet_NodeType>(action.type))
-                {
-                    if (nodeType->action == Red::populationSpawnerObjectCtrlAction::Activate ||
-                        nodeType->action == Red::populationSpawnerObjectCtrlAction::Reactivate)
-                    {
-                        spawnSets.push_back(nodeType);
-                    }
-                }
-            }
-        }
+    [[nodiscard]] inline std::span<const Red::Handle<Red::questVarComparison_ConditionType>> FindFactConditions() const
+    {
+        return m_pauseConditions.Get<Red::questVarComparison_ConditionType>();
+    }
+
+    [[nodiscard]] inline std::span<const Red::Handle<Red::questEventManagerNodeDefinition>> FindManagerEvents() const
+    {
+        return GetNodesOfType<Red::questEventManagerNodeDefinition>();
+    }
 
-        return spawnSets;
+    [[nodiscard]] inline std::span<const Red::Handle<Red::questJournalNodeDefinition>> FindJournalEntries() const
+    {
+        return GetNodesOfType<Red::questJournalNodeDefinition>();
     }
 
-    inline Core::Vector<Red::Handle<Red::questSpawner_NodeType>> FindSpawners()
+    [[nodiscard]] inline Core::Vector<Red::gameJournalPath*> FindJournalConditions() const
     {
-        Core::Vector<Red::Handle<Red::questSpawner_NodeType>> spawners;
+        Core::Vector<Red::gameJournalPath*> conditions;
 
-        for (const auto& node : GetNodesOfType<Red::questSpawnManagerNodeDefinition>())
+        for (const auto& conditionType : m_pauseConditions.Get<Red::questJournalEntry_ConditionType>())
         {
-            for (const auto& action : node->actions)
+            if (conditionType->state == Red::gameJournalEntryUserState::Active)
             {
-                if (const auto& nodeType = Red::Cast<Red::questSpawner_NodeType>(action.type))
-                {
-                    if (nodeType->action == Red::populationSpawnerObjectCtrlAction::Activate ||
-                        nodeType->action == Red::populationSpawnerObjectCtrlAction::Reactivate)
-                    {
-                        spawners.push_back(nodeType);
-                    }
-                }
+                conditions.push_back(conditionType->path.instance);
             }
         }
 
-        return spawners;
+        for (const auto& conditionType : m_pauseConditions.Get<Red::questJournalEntryState_ConditionType>())
+        {
+            if (conditionType->state == Red::gameJournalEntryState::Active && !conditionType->inverted)
+            {
+                conditions.push_back(conditionType->path.instance);
+            }
+        }
+
+        return conditions;
     }
 
-    inline Core::Vector<Red::Handle<Red::questSetVar_NodeType>> FindFactChanges()
+    [[nodiscard]] inline Core::Vector<Red::questInventory_ConditionType*> FindLootConditions() const
     {
-        Core::Vector<Red::Handle<Red::questSetVar_NodeType>> changes;
+        Core::Vector<Red::questInventory_ConditionType*> conditions;
 
-        for (const auto& node : GetNodesOfType<Red::questFactsDBManagerNodeDefinition>())
+        for (const auto& conditionType : m_pauseConditions.Get<Red::questInventory_ConditionType>())
         {
-            if (const auto& setVarType = Red::Cast<Red::questSetVar_NodeType>(node->type))
+            if (conditionType->isPlayer)
             {
-                changes.push_back(setVarType);
+                conditions.push_back(conditionType.instance);
             }
         }
 
-        return changes;
+        return conditions;
     }
 
-    inline Core::Vector<Red::Handle<Red::questVarComparison_ConditionType>> FindFactConditions()
+    [[nodiscard]] inline Red::Handle<Red::questInteraction_ConditionType> FindLootContainerCondition() const
     {
-        Core::Vector<Red::Handle<Red::questVarComparison_ConditionType>> conditions;
-
-        for (const auto& node : GetNodesOfType<Red::questPauseConditionNodeDefinition>())
+        for (const auto& conditionType : m_pauseConditions.Get<Red::questInteraction_ConditionType>())
         {
-            if (const auto& condition = Red::Cast<Red::questFactsDBCondition>(node->condition))
+            if (conditionType->eventType == Red::questObjectInteractionEventType::Executed)
             {
-                if (const auto& conditionType = Red::Cast<Red::questVarComparison_ConditionType>(condition->type))
-                {
-                    conditions.push_back(conditionType);
-                }
+                return conditionType;
             }
         }
 
-        return conditions;
+        return {};
     }
 
-    inline Core::Vector<Red::Handle<Red::questEventManagerNodeDefinition>> FindManagerEvents()
+    [[nodiscard]] inline Red::Handle<Red::questCharacterKilled_ConditionType> FindCharacterKillCondition() const
     {
-        return GetNodesOfType<Red::questEventManagerNodeDefinition>();
+        for (const auto& conditionType : m_pauseConditions.Get<Red::questCharacterKilled_ConditionType>())
+        {
+            return conditionType;
+        }
+
+        for (const auto& conditionType : m_conditions.Get<Red::questCharacterKilled_ConditionType>())
+        {
+            return conditionType;
+        }
+
+        return {};
     }
 
-    inline Core::Vector<Red::Handle<Red::questJournalNodeDefinition>> FindJournalEntries()
+    [[nodiscard]] inline Core::Vector<Red::QuestNodeKey> GetAllGraphNodePaths(const Red::QuestNodePath& aPhaseNodePath) const
     {
-        return GetNodesOfType<Red::questJournalNodeDefinition>();
+        Core::Vector<Red::QuestNodeKey> allPaths;
+        CollectPaths(allPaths, aPhaseNodePath, m_graph);
+        return allPaths;
     }
 
-    inline Core::Vector<Red::Handle<Red::gameJournalPath>> FindJournalConditions()
+private:
+    // Groups handles by the class name of the referenced object.
+    // Handles are staged in visiting order and then moved into one contiguous array,
+    // so each type occupies a single span and keeps the original order.
+    class TypeBuckets
     {
-        Core::Vector<Red::Handle<Red::gameJournalPath>> conditions;
+    public:
+        inline void Add(Red::CName aType, const Red::Handle<Red::ISerializable>& aItem)
+        {
+            m_staging.emplace_back(aType, aItem);
+        }
 
-        for (const auto& node : GetNodesOfType<Red::questPauseConditionNodeDefinition>())
+        inline void Build()
         {
-            if (const auto& condition = Red::Cast<Red::questJournalCondition>(node->condition))
+            Core::Map<Red::CName, uint32_t> cursors;
+
+            for (const auto& [type, _] : m_staging)
             {
-                if (const auto& conditionType = Red::Cast<Red::questJournalEntry_ConditionType>(condition->type))
-                {
-                    if (conditionType->state == Red::gameJournalEntryUserState::Active)
-                    {
-                        conditions.push_back(conditionType->path);
-                    }
-                    continue;
-                }
-                if (const auto& conditionType = Red::Cast<Red::questJournalEntryState_ConditionType>(condition->type))
-                {
-                    if (conditionType->state == Red::gameJournalEntryState::Active && !conditionType->inverted)
-                    {
-                        conditions.push_back(conditionType->path);
-                    }
-                }
+                ++m_ranges[type].count;
+            }
+
+            uint32_t offset = 0;
+            for (auto it = m_ranges.begin(); it != m_ranges.end(); ++it)
+            {
+                it.value().offset = offset;
+                cursors[it->first] = offset;
+                offset += it->second.count;
+            }
+
+            m_items.resize(offset);
+
+            for (auto& [type, item] : m_staging)
+            {
+                m_items[cursors[type]++] = std::move(item);
             }
+
+            m_staging.clear();
+            m_staging.shrink_to_fit();
         }
 
-        return conditions;
-    }
+        template<class T>
+        [[nodiscard]] inline std::span<const Red::Handle<T>> Get() const
+        {
+            const auto& it = m_ranges.find(Red::GetTypeName<T>());
+
+            if (it == m_ranges.end())
+                return {};
+
+            const auto* items = reinterpret_cast<const Red::Handle<T>*>(m_items.data());
 
-    inline Core::Vector<Red::Handle<Red::questInventory_ConditionType>> FindLootConditions()
+            return {items + it->second.offset, it->second.count};
+        }
+
+    private:
+        struct Range
+        {
+            uint32_t offset{0};
+            uint32_t count{0};
+        };
+
+        Core::Vector<std::pair<Red::CName, Red::Handle<Red::ISerializable>>> m_staging;
+        Core::Vector<Red::Handle<Red::ISerializable>> m_items;
+        Core::Map<Red::CName, Range> m_ranges;
+    };
+
+    template<class T>
+    [[nodiscard]] inline Core::Vector<T*> FindActivatedSpawnActions() const
     {
-        Core::Vector<Red::Handle<Red::questInventory_ConditionType>> conditions;
+        Core::Vector<T*> actions;
 
-        for (const auto& node : GetNodesOfType<Red::questPauseConditionNodeDefinition>())
+        for (const auto& action : m_spawnActions.Get<T>())
         {
-            if (const auto& condition = Red::Cast<Red::questObjectCondition>(node->condition))
+            if (action->action == Red::populationSpawnerObjectCtrlAction::Activate ||
+                action->action == Red::populationSpawnerObjectCtrlAction::Reactivate)
             {
-                if (const auto& conditionType = Red::Cast<Red::questInventory_ConditionType>(condition->type))
-                {
-                    if (conditionType->isPlayer)
-                    {
-                        conditions.push_back(conditionType);
-                    }
-                }
+                actions.push_back(action.instance);
             }
         }
 
-        return conditions;
+        return actions;
     }
 
-    inline Red::Handle<Red::questInteraction_ConditionType> FindLootContainerCondition()
+    inline static void CollectPaths(Core::Vector<Red::QuestNodeKey>& aOutPaths,
+                                    const Red::QuestNodePath& aPhaseNodePath,
+                                    const Red::Handle<Red::questGraphDefinition>& aPhaseGraph)
     {
-        for (const auto& node : GetNodesOfType<Red::questPauseConditionNodeDefinition>())
+        for (const auto& node : aPhaseGraph->nodes)
         {
-            if (const auto& condition = Red::Cast<Red::questObjectCondition>(node->condition))
+            if (auto questNode = Red::Cast<Red::questNodeDefinition>(node))
             {
-                if (const auto& conditionType = Red::Cast<Red::questInteraction_ConditionType>(condition->type))
+                aOutPaths.emplace_back(aPhaseNodePath, questNode->id);
+
+                if (const auto& phaseNode = Red::Cast<Red::questPhaseNodeDefinition>(node))
                 {
-                    if (conditionType->eventType == Red::questObjectInteractionEventType::Executed)
+                    if (phaseNode->phaseGraph)
                     {
-                        return conditionType;
+                        auto nestedPhaseNodePath = aPhaseNodePath;
+                        nestedPhaseNodePath.PushBack(questNode->id);
+
+                        CollectPaths(aOutPaths, nestedPhaseNodePath, phaseNode->phaseGraph);
                     }
                 }
             }
         }
-
-        return {};
     }
 
-    inline Red::Handle<Red::questCharacterKilled_ConditionType> FindCharacterKillCondition()
+    // Values without a stable representation, like pointers and buffers owned by the engine,
+    // are hashed by their bytes as they are, which can only cause a cache miss, never a stale record.
+    struct ContentHasher
     {
-        for (const auto& node : GetNodesOfType<Red::questPauseConditionNodeDefinition>())
+        inline void HashBytes(const void* aData, size_t aSize)
         {
-            if (const auto& condition = Red::Cast<Red::questCharacterCondition>(node->condition))
+            const auto* bytes = reinterpret_cast<const uint8_t*>(aData);
+
+            for (size_t i = 0; i < aSize; ++i)
             {
-                if (const auto& conditionType = Red::Cast<Red::questCharacterKilled_ConditionType>(condition->type))
-                {
-                    return conditionType;
-                }
+                hash ^= bytes[i];
+                hash *= 0x100000001B3;
+            }
+        }
+
+        template<typename T>
+        inline void HashScalar(const T& aValue)
+        {
+            HashBytes(&aValue, sizeof(T));
+        }
+
+        inline void HashObject(Red::ISerializable* aObject)
+        {
+            if (!aObject)
+            {
+                HashScalar<uint32_t>(0);
+                return;
+            }
+
+            // Shared and cyclic references hash the order in which the object was first seen
+            auto [it, inserted] = objects.emplace(aObject, static_cast<uint32_t>(objects.size() + 1));
+            HashScalar(it->second);
+
+            if (!inserted)
+                return;
+
+            auto* type = aObject->GetType();
+            HashScalar(type->GetName().hash);
+
+            Red::DynArray<Red::CProperty*> props;
+            type->GetProperties(props);
+
+            for (const auto& prop : props)
+            {
+                HashValue(prop->type, prop->GetValuePtr<void>(aObject));
             }
         }
 
-        for (const auto& node : GetNodesOfType<Red::questConditionNodeDefinition>())
+        inline void HashValue(Red::CBaseRTTIType* aType, void* aValue)
         {
-            if (const auto& condition = Red::Cast<Red::questCharacterCondition>(node->condition))
+            switch (aType->GetType())
+            {
+            case Red::ERTTIType::Handle:
+            {
+                HashObject(reinterpret_cast<Red::Handle<Red::ISerializable>*>(aValue)->instance);
+                break;
+            }
+            case Red::ERTTIType::WeakHandle:
+            {
+                HashObject(reinterpret_cast<Red::WeakHandle<Red::ISerializable>*>(aValue)->Lock().instance);
+                break;
+            }
+            case Red::ERTTIType::Array:
+            case Red::ERTTIType::StaticArray:
+            case Red::ERTTIType::NativeArray:
+            case Red::ERTTIType::FixedArray:
+            {
+                auto* arrayType = reinterpret_cast<Red::CRTTIBaseArrayType*>(aType);
+                auto* innerType = arrayType->GetInnerType();
+                const auto length = arrayType->GetLength(aValue);
+
+                HashScalar(length);
+
+                for (uint32_t i = 0; i < length; ++i)
+                {
+                    HashValue(innerType, arrayType->GetElement(aValue, i));
+                }
+                break;
+            }
+            case Red::ERTTIType::Class:
             {
-                if (const auto& conditionType = Red::Cast<Red::questCharacterKilled_ConditionType>(condition->type))
+                Red::DynArray<Red::CProperty*> props;
+                reinterpret_cast<Red::CClass*>(aType)->GetProperties(props);
+
+                for (const auto& prop : props)
                 {
-                    return conditionType;
+                    HashValue(prop->type, prop->GetValuePtr<void>(aValue));
                 }
+                break;
+            }
+            case Red::ERTTIType::ResourceReference:
+            {
+                HashScalar(reinterpret_cast<Red::ResourceReference<>*>(aValue)->path);
+                break;
+            }
+            case Red::ERTTIType::Simple:
+            {
+                const auto typeName = aType->GetName();
+
+                if (typeName == Red::GetTypeName<Red::CString>())
+                {
+                    const auto* str = reinterpret_cast<Red::CString*>(aValue);
+                    HashBytes(str->c_str(), str->Length());
+                }
+                else if (typeName == Red::GetTypeName<Red::Variant>())
+                {
+                    const auto* variant = reinterpret_cast<Red::Variant*>(aValue);
+                    if (auto* variantType = variant->GetType())
+                    {
+                        HashScalar(variantType->GetName().hash);
+                        HashValue(variantType, variant->GetDataPtr());
+                    }
+                }
+                else if (typeName == Red::GetTypeName<Red::DataBuffer>())
+                {
+                    const auto* buffer = reinterpret_cast<Red::DataBuffer*>(aValue);
+                    HashBytes(buffer->buffer.data, buffer->buffer.size);
+                }
+                else
+                {
+                    HashBytes(aValue, aType->GetSize());
+                }
+                break;
+            }
+            default:
+            {
+                HashBytes(aValue, aType->GetSize());
+                break;
+            }
             }
         }
 
-        return {};
+        uint64_t hash{0xCBF29CE484222325};
+        Core::Map<Red::ISerializable*, uint32_t> objects;
+    };
+
+    template<class T>
+    inline static void AddTyped(TypeBuckets& aBuckets, const Red::Handle<T>& aItem)
+    {
+        if (aItem)
+        {
+            aBuckets.Add(aItem->GetType()->name, *reinterpret_cast<const Red::Handle<Red::ISerializable>*>(&aItem));
+        }
     }
 
-    inline Core::Vector<Red::QuestNodeKey> GetAllGraphNodePaths(const Red::QuestNodePath& aPhaseNodePath)
+    template<class T>
+    inline static bool IndexNodeType(TypeBuckets& aBuckets, Red::CName aNodeType,
+                                     const Red::Handle<Red::graphGraphNodeDefinition>& aNode)
     {
-        Core::Vector<Red::QuestNodeKey> allPaths;
-        CollectPaths(allPaths, aPhaseNodePath, m_graph);
-        return allPaths;
+        if (aNodeType != Red::GetTypeName<T>())
+            return false;
+
+        const auto& typedNode = *reinterpret_cast<const Red::Handle<T>*>(&aNode);
+        AddTyped(aBuckets, typedNode->type);
+        return true;
     }
 
-private:
-    inline void CollectPaths(Core::Vector<Red::QuestNodeKey>& aOutPaths,
-                             const Red::QuestNodePath& aPhaseNodePath,
-                             const Red::Handle<Red::questGraphDefinition>& aPhaseGraph)
+    template<class T>
+    inline static bool IndexCondition(TypeBuckets& aBuckets, const Red::Handle<Red::questIBaseCondition>& aCondition)
     {
-        for (const auto& node : aPhaseGraph->nodes)
+        if (const auto& condition = Red::Cast<T>(aCondition))
         {
-            if (auto questNode = Red::Cast<Red::questNodeDefinition>(node))
-            {
-                aOutPaths.emplace_back(aPhaseNodePath, questNode->id);
+            AddTyped(aBuckets, condition->type);
+            return true;
+        }
 
-                if (const auto& phaseNode = Red::Cast<Red::questPhaseNodeDefinition>(node))
-                {
-                    if (phaseNode->phaseGraph)
-                    {
-                        auto nestedPhaseNodePath = aPhaseNodePath;
-                        nestedPhaseNodePath.PushBack(questNode->id);
+        return false;
+    }
 
-                        CollectPaths(aOutPaths, nestedPhaseNodePath, phaseNode->phaseGraph);
-                    }
-                }
-            }
-        }
+    inline static void IndexConditions(TypeBuckets& aBuckets, const Red::Handle<Red::questIBaseCondition>& aCondition)
+    {
+        if (!aCondition)
+            return;
+
+        IndexCondition<Red::questFactsDBCondition>(aBuckets, aCondition) ||
+            IndexCondition<Red::questJournalCondition>(aBuckets, aCondition) ||
+            IndexCondition<Red::questObjectCondition>(aBuckets, aCondition) ||
+            IndexCondition<Red::questCharacterCondition>(aBuckets, aCondition);
     }
 
     inline void CollectNodes(const Red::Handle<Red::questGraphDefinition>& aPhaseGraph, bool aRecursive)
@@ -305,7 +493,40 @@ private:
 
         for (const auto& node : aPhaseGraph->nodes)
         {
-            m_nodesByType[node->GetType()->name].push_back(node);
+            const auto nodeType = node->GetType()->name;
+
+            m_nodes.Add(nodeType, *reinterpret_cast<const Red::Handle<Red::ISerializable>*>(&node));
+
+            if (IndexNodeType<Red::questJournalNodeDefinition>(m_nodeTypes, nodeType, node) ||
+                IndexNodeType<Red::questFactsDBManagerNodeDefinition>(m_nodeTypes, nodeType, node) ||
+                IndexNodeType<Red::questWorldDataManagerNodeDefinition>(m_nodeTypes, nodeType, node))
+                continue;
+
+            if (nodeType == Red::GetTypeName<Red::questSpawnManagerNodeDefinition>())
+            {
+                const auto& spawnNode = *reinterpret_cast<const Red::Handle<Red::questSpawnManagerNodeDefinition>*>(&node);
+
+                for (const auto& action : spawnNode->actions)
+                {
+                    AddTyped(m_spawnActions, action.type);
+                }
+
+                continue;
+            }
+
+            if (nodeType == Red::GetTypeName<Red::questPauseConditionNodeDefinition>())
+            {
+                const auto& pauseNode = *reinterpret_cast<const Red::Handle<Red::questPauseConditionNodeDefinition>*>(&node);
+                IndexConditions(m_pauseConditions, pauseNode->condition);
+                continue;
+            }
+
+            if (nodeType == Red::GetTypeName<Red::questConditionNodeDefinition>())
+            {
+                const auto& conditionNode = *reinterpret_cast<const Red::Handle<Red::questConditionNodeDefinition>*>(&node);
+                IndexConditions(m_conditions, conditionNode->condition);
+                continue;
+            }
 
             if (const auto& phaseNode = Red::Cast<Red::questPhaseNodeDefinition>(node))
             {
@@ -325,7 +546,11 @@ private:
         }
     }
 
-    const Red::Handle<Red::questGraphDefinition>& m_graph;
-    Core::Map<Red::CName, Core::Vector<Red::Handle<Red::graphGraphNodeDefinition>>> m_nodesByType;
+    Red::Handle<Red::questGraphDefinition> m_graph;
+    TypeBuckets m_nodes;
+    TypeBuckets m_nodeTypes;
+    TypeBuckets m_spawnActions;
+    TypeBuckets m_pauseConditions;
+    TypeBuckets m_conditions;
 };
 }
@@ -1,7 +1,10 @@
 #include "QuestPhaseRegistry.hpp"
 #include "App/Device/ResetSecuritySystemNetwork.hpp"
+#include "App/Project.hpp"
+#include "App/Quest/ActivityCache.hpp"
 #include "App/Quest/QuestPhaseGraphBuilder.hpp"
 #include "App/World/DistrictResolver.hpp"
+#include "Core/Facades/Runtime.hpp"
 #include "Red/NodeRef.hpp"
 #include "Red/TweakDB.hpp"
 
@@ -18,6 +21,28 @@ constexpr auto OpenWorldPhaseResources = {
     Red::ResourcePath(R"(base\open_world\vendors\open_world_vendors.questphase)"),
     Red::ResourcePath(R"(base\quest\bugfixing\open_world_bugfixing.questphase)"),
 };
+
+constexpr auto HiddenPrefabActivityResource = Red::ResourcePath(R"(base\open_world\minor_activities\badlands\inland_avenue_se1\ma_bls_se1_ina_09\ma_bls_ina_se1_09_phase.questphase)");
+
+struct PhaseCacheKey
+{
+    uint64_t resourcePath;
+    uint64_t graphContent;
+    uint64_t minorActivity;
+};
+
+uint64_t GetGameBuild()
+{
+    const auto& fileVer = Core::Runtime::GetHost()->GetFileVer();
+
+    return (static_cast<uint64_t>(fileVer.major) << 48) | (static_cast<uint64_t>(fileVer.minor) << 32) |
+           (static_cast<uint64_t>(fileVer.build) << 16) | fileVer.revision;
+}
+}
+
+App::QuestPhaseRegistry::QuestPhaseRegistry(const std::filesystem::path& aCachePath)
+{
+    s_cachePath = aCachePath;
 }
 
 void App::QuestPhaseRegistry::OnBootstrap()
@@ -68,8 +93,17 @@ void App::QuestPhaseRegistry::OnInitializePhase(Red::questPhaseInstance* aPhase,
     {
         std::unique_lock activitiesLockRW(s_activitiesLock);
 
+        {
+            std::unique_lock pendingLockRW(s_pendingScansLock);
+            s_pendingScans.reset();
+        }
+
         s_activitiesReady = false;
+        s_activitiesLoading = false;
         s_activities.clear();
+        s_activitiesByKind.clear();
+        s_activitiesByDistrict.clear();
+        ++s_activitiesGeneration;
 
         s_phasesReady = false;
         s_phases.clear();
@@ -121,69 +155,246 @@ bool App::QuestPhaseRegistry::ActivitiesInitialized()
     return s_activitiesReady;
 }
 
-void App::QuestPhaseRegistry::InitializeActivities()
+float App::QuestPhaseRegistry::GetActivitiesProgress()
 {
     if (ActivitiesInitialized())
-        return;
+        return 1.0f;
 
-    std::shared_lock phasesLockR(s_phasesLock);
-    std::unique_lock activitiesLockRW(s_activitiesLock);
+    const auto total = s_activitiesTotal.load();
 
-    Core::Vector<Red::questPhaseInstance*> communityPhases;
+    if (total == 0)
+        return 0.0f;
 
-    for (auto& [_, phaseWeak] : s_phases)
-    {
-        auto phase = phaseWeak.Lock();
+    // The last step is reserved for the merge, so the progress never reaches 1.0 before activities are ready
+    return static_cast<float>(s_activitiesScanned.load()) / static_cast<float>(total + 1);
+}
 
-        if (!phase)
-            continue;
+void App::QuestPhaseRegistry::InitializeActivities()
+{
+    if (ActivitiesInitialized() || s_activitiesLoading.exchange(true))
+        return;
 
-        auto& phaseInstance = phase.instance;
-        auto& phaseResource = Raw::QuestPhaseInstance::Resource::Ref(phaseInstance);
+    auto batch = Core::MakeShared<PhaseScanBatch>();
 
-        if (!phaseResource)
-            continue;
+    {
+        std::shared_lock phasesLockR(s_phasesLock);
 
-        auto& phaseGraph = Raw::QuestPhaseInstance::Graph::Ref(phaseInstance);
-        auto& phaseNodePath = Raw::QuestPhaseInstance::NodePath::Ref(phaseInstance);
-        auto& phaseNodePathHash = Raw::QuestPhaseInstance::NodePathHash::Ref(phaseInstance);
+        batch->generation = s_activitiesGeneration;
 
-        for (const auto& openWorldPhasePath : OpenWorldPhaseResources)
+        for (auto& [_, phaseWeak] : s_phases)
         {
-            const auto& openWorldPhaseNodePathIt = s_openWorldPhaseNodePaths.find(openWorldPhasePath);
-            if (openWorldPhaseNodePathIt == s_openWorldPhaseNodePaths.end())
+            auto phase = phaseWeak.Lock();
+
+            if (!phase)
                 continue;
 
-            const auto& openWorldPhaseNodePath = openWorldPhaseNodePathIt.value();
-            if (!Red::IsRelatedQuestNodePath(openWorldPhaseNodePath, phaseNodePath))
+            auto& phaseInstance = phase.instance;
+            auto& phaseResource = Raw::QuestPhaseInstance::Resource::Ref(phaseInstance);
+
+            if (!phaseResource)
                 continue;
 
-            if (openWorldPhasePath == MinorActivitiesResource)
-            {
-                QuestPhaseGraphAccessor phaseGraphAccessor{phaseGraph, true};
-                ApplyActivityBugfixes(phaseGraphAccessor, phaseResource, phaseGraph);
-                RegisterMinorActivity(phaseGraphAccessor, phaseInstance, phaseResource, phaseGraph, phaseNodePath);
-            }
-            else
+            auto& phaseNodePath = Raw::QuestPhaseInstance::NodePath::Ref(phaseInstance);
+
+            for (const auto& openWorldPhasePath : OpenWorldPhaseResources)
             {
-                communityPhases.push_back(phaseInstance);
+                const auto& openWorldPhaseNodePathIt = s_openWorldPhaseNodePaths.find(openWorldPhasePath);
+                if (openWorldPhaseNodePathIt == s_openWorldPhaseNodePaths.end())
+                    continue;
+
+                const auto& openWorldPhaseNodePath = openWorldPhaseNodePathIt.value();
+                if (!Red::IsRelatedQuestNodePath(openWorldPhaseNodePath, phaseNodePath))
+                    continue;
+
+                const auto minorActivity = openWorldPhasePath == MinorActivitiesResource;
+
+#ifdef NDEBUG
+                if (!minorActivity)
+                    break;
+#endif
+
+                batch->scans.push_back({std::move(phase), minorActivity,
+                                        minorActivity && HasActivityBugfixes(phaseResource)});
+                break;
             }
+        }
+    }
 
-            break;
+    batch->build = GetGameBuild();
+    batch->fingerprint = Red::FNV1a64(Project::Version.to_string().c_str());
+
+    s_activitiesScanned = 0;
+    s_activitiesTotal = static_cast<uint32_t>(batch->scans.size());
+
+    if (batch->scans.empty())
+    {
+        MergePhaseScans(batch);
+        return;
+    }
+
+    LoadPhaseScans(batch);
+
+    batch->pending = static_cast<uint32_t>(batch->scans.size());
+
+    {
+        std::unique_lock pendingLockRW(s_pendingScansLock);
+        s_pendingScans = batch;
+    }
+
+    // Scan jobs only read quest graphs, everything that modifies the game state
+    // is deferred until the batch is finalized on the game thread.
+    // Phases with unchanged content are restored from the cache instead of being extracted.
+    for (uint32_t index = 0; index < batch->scans.size(); ++index)
+    {
+        Red::JobQueue jobQueue;
+        jobQueue.Dispatch([batch, index] {
+            ScanPhase(batch, index);
+        });
+    }
+}
+
+void App::QuestPhaseRegistry::FinalizeActivities()
+{
+    PhaseScanBatchPtr batch;
+
+    {
+        std::unique_lock pendingLockRW(s_pendingScansLock);
+
+        if (!s_pendingScans || s_pendingScans->pending > 0)
+            return;
+
+        batch = std::move(s_pendingScans);
+    }
+
+    for (auto& scan : batch->scans)
+    {
+        if (scan.bugfixes)
+        {
+            ScanBugfixedPhase(scan);
         }
     }
 
-#ifndef NDEBUG
-    for (auto& phaseInstance : communityPhases)
+    MergePhaseScans(batch);
+}
+
+void App::QuestPhaseRegistry::ScanPhase(const PhaseScanBatchPtr& aBatch, uint32_t aIndex)
+{
+    auto& scan = aBatch->scans[aIndex];
+    auto& phaseInstance = scan.phase.instance;
+    auto& phaseResource = Raw::QuestPhaseInstance::Resource::Ref(phaseInstance);
+    auto& phaseGraph = Raw::QuestPhaseInstance::Graph::Ref(phaseInstance);
+    auto& phaseNodePath = Raw::QuestPhaseInstance::NodePath::Ref(phaseInstance);
+
+    PhaseCacheKey phaseKey{phaseResource->path.hash,
+                           QuestPhaseGraphAccessor::ComputeContentHash(phaseResource, phaseGraph),
+                           scan.minorActivity};
+    scan.contentHash = Red::FNV1a64(reinterpret_cast<const uint8_t*>(&phaseKey), sizeof(phaseKey));
+
+    if (scan.cached && scan.cachedHash == scan.contentHash && RestorePhaseScan(scan))
     {
-        auto& phaseGraph = Raw::QuestPhaseInstance::Graph::Ref(phaseInstance);
-        auto& phaseNodePathHash = Raw::QuestPhaseInstance::NodePathHash::Ref(phaseInstance);
+        scan.restored = true;
 
-        QuestPhaseGraphAccessor phaseGraphAccessor{phaseGraph, true};
+        // Bugfixes are still applied to the live graph when the batch is finalized
+        if (!scan.bugfixes)
+        {
+            ++s_activitiesScanned;
+        }
 
+        --aBatch->pending;
+        return;
+    }
+
+    scan.activity.reset();
+    scan.factNames.clear();
+
+    if (scan.bugfixes)
+    {
+        --aBatch->pending;
+        return;
+    }
+
+    QuestPhaseGraphAccessor phaseGraphAccessor{phaseGraph, true};
+
+    if (scan.minorActivity)
+    {
+        scan.activity = ScanMinorActivity(phaseGraphAccessor, phaseInstance, phaseResource, phaseGraph,
+                                          phaseNodePath);
+    }
+    else
+    {
         for (const auto& factCondition : phaseGraphAccessor.FindFactConditions())
         {
-            Red::FactID factID{factCondition->factName.c_str()};
+            scan.factNames.emplace_back(factCondition->factName.c_str());
+        }
+    }
+
+    ++s_activitiesScanned;
+    --aBatch->pending;
+}
+
+void App::QuestPhaseRegistry::ScanBugfixedPhase(PhaseScan& aScan)
+{
+    auto& phaseInstance = aScan.phase.instance;
+    auto& phaseResource = Raw::QuestPhaseInstance::Resource::Ref(phaseInstance);
+    auto& phaseGraph = Raw::QuestPhaseInstance::Graph::Ref(phaseInstance);
+    auto& phaseNodePath = Raw::QuestPhaseInstance::NodePath::Ref(phaseInstance);
+
+    // Bugfixes modify the graph, so these phases are extracted after the fixes are applied
+    QuestPhaseGraphAccessor phaseGraphAccessor{phaseGraph, true};
+    ApplyActivityBugfixes(phaseGraphAccessor, phaseResource, phaseGraph);
+
+    if (!aScan.restored)
+    {
+        aScan.activity = ScanMinorActivity(phaseGraphAccessor, phaseInstance, phaseResource, phaseGraph,
+                                           phaseNodePath);
+    }
+
+    ++s_activitiesScanned;
+}
+
+void App::QuestPhaseRegistry::MergePhaseScans(const PhaseScanBatchPtr& aBatch)
+{
+    const auto modified = aBatch->cachedCount != aBatch->scans.size() ||
+                          std::ranges::any_of(aBatch->scans, [](const PhaseScan& aScan) { return !aScan.restored; });
+
+    if (modified && !aBatch->scans.empty())
+    {
+        StorePhaseScans(aBatch);
+    }
+
+    // Resolving touches the journal, scripts and quest graphs,
+    // so it's done on the game thread after all scans are finished
+    Core::Vector<Core::SharedPtr<ActivityDefinition>> activities;
+
+    for (auto& scan : aBatch->scans)
+    {
+        if (scan.activity && ResolveMinorActivity(scan.activity))
+        {
+            activities.push_back(std::move(scan.activity));
+        }
+    }
+
+    std::unique_lock activitiesLockRW(s_activitiesLock);
+
+    if (aBatch->generation != s_activitiesGeneration)
+        return;
+
+    for (const auto& activity : activities)
+    {
+        RegisterMinorActivity(activity);
+    }
+
+#ifndef NDEBUG
+    for (const auto& scan : aBatch->scans)
+    {
+        if (scan.minorActivity)
+            continue;
+
+        auto& phaseNodePathHash = Raw::QuestPhaseInstance::NodePathHash::Ref(scan.phase.instance);
+
+        for (const auto& factName : scan.factNames)
+        {
+            Red::FactID factID{factName.c_str()};
 
             auto it = s_activitiesByFacts.find(factID);
             if (it != s_activitiesByFacts.end())
@@ -192,7 +403,7 @@ void App::QuestPhaseRegistry::InitializeActivities()
 
                 for (const auto& activityName : it.value())
                 {
-                    LogDebug("Population: {} {} {}", activityName.ToString(), phaseNodePathHash, factCondition->factName.c_str());
+                    LogDebug("Population: {} {} {}", activityName.ToString(), phaseNodePathHash, factName);
                 }
             }
         }
@@ -200,21 +411,119 @@ void App::QuestPhaseRegistry::InitializeActivities()
 #endif
 
     s_activitiesReady = true;
+    s_activitiesLoading = false;
 }
 
-bool App::QuestPhaseRegistry::ApplyActivityBugfixes(App::QuestPhaseGraphAccessor& aPhaseGraphAccessor,
-                                                    const Red::Handle<Red::questQuestPhaseResource>& aPhaseResource,
-                                                    Red::Handle<Red::questGraphDefinition>& aPhaseGraph)
+void App::QuestPhaseRegistry::LoadPhaseScans(const PhaseScanBatchPtr& aBatch)
 {
-    if (aPhaseResource->path == R"(base\open_world\minor_activities\badlands\inland_avenue_se1\ma_bls_se1_ina_09\ma_bls_ina_se1_09_phase.questphase)")
+    Core::Vector<ActivityCache::PhaseEntry> cachedPhases;
+
+    if (!ActivityCache::Load(s_cachePath, aBatch->build, aBatch->fingerprint, cachedPhases))
+        return;
+
+    Core::Map<Red::QuestNodePathHash, PhaseScan*> scansByPath;
+
+    for (auto& scan : aBatch->scans)
+    {
+        scansByPath[Raw::QuestPhaseInstance::NodePathHash::Ref(scan.phase.instance)] = &scan;
+    }
+
+    // Cached records are only candidates, scan jobs compare them against the current graph content
+    for (auto& entry : cachedPhases)
     {
-        for (auto& prefabNode : aPhaseGraphAccessor.GetNodesOfType<Red::questWorldDataManagerNodeDefinition>())
+        const auto& scanIt = scansByPath.find(entry.phaseNodePathHash);
+        if (scanIt == scansByPath.end())
+            continue;
+
+        auto* scan = scanIt.value();
+        scan->cached = true;
+        scan->cachedHash = entry.contentHash;
+        scan->inputNodeID = entry.inputNodeID;
+        scan->activity = std::move(entry.activity);
+        scan->factNames = std::move(entry.factNames);
+
+        ++aBatch->cachedCount;
+    }
+}
+
+bool App::QuestPhaseRegistry::RestorePhaseScan(PhaseScan& aScan)
+{
+    if (!aScan.activity)
+        return true;
+
+    auto& phaseInstance = aScan.phase.instance;
+    auto& phaseResource = Raw::QuestPhaseInstance::Resource::Ref(phaseInstance);
+    auto& phaseGraph = Raw::QuestPhaseInstance::Graph::Ref(phaseInstance);
+    auto& phaseNodePath = Raw::QuestPhaseInstance::NodePath::Ref(phaseInstance);
+
+    Red::Handle<Red::questInputNodeDefinition> inputNode;
+
+    for (const auto& node : phaseGraph->nodes)
+    {
+        if (const auto& candidate = Red::Cast<Red::questInputNodeDefinition>(node))
         {
-            if (auto& prefabNodeType = Red::Cast<Red::questShowWorldNode_NodeType>(prefabNode->type))
+            if (candidate->id == aScan.inputNodeID)
             {
-                prefabNodeType->show = false;
+                inputNode = candidate;
+                break;
             }
         }
+    }
+
+    if (!inputNode)
+        return false;
+
+    auto& activity = aScan.activity;
+
+    activity->phaseInstance = phaseInstance;
+    activity->phaseGraph = phaseGraph;
+    activity->phaseResource = phaseResource;
+    activity->phaseNodeKey = phaseNodePath;
+    activity->phaseNodePath = phaseNodePath;
+
+    activity->inputNode = inputNode;
+    activity->inputSocket = {inputNode->socketName};
+    activity->inputNodeKey = {phaseNodePath, inputNode->id};
+
+    return true;
+}
+
+void App::QuestPhaseRegistry::StorePhaseScans(const PhaseScanBatchPtr& aBatch)
+{
+    Core::Vector<ActivityCache::PhaseEntry> phases;
+    phases.reserve(aBatch->scans.size());
+
+    for (const auto& scan : aBatch->scans)
+    {
+        auto& phase = phases.emplace_back();
+        phase.phaseNodePathHash = Raw::QuestPhaseInstance::NodePathHash::Ref(scan.phase.instance);
+        phase.contentHash = scan.contentHash;
+        phase.inputNodeID = scan.activity ? scan.activity->inputNodeKey.nodeID : Red::QuestNodeID{};
+        phase.activity = scan.activity;
+        phase.factNames = scan.factNames;
+    }
+
+    if (!ActivityCache::Save(s_cachePath, aBatch->build, aBatch->fingerprint, phases))
+    {
+        LogWarning(R"([QuestPhaseRegistry] Can't save activity cache to "{}".)", s_cachePath.string());
+    }
+}
+
+bool App::QuestPhaseRegistry::HasActivityBugfixes(const Red::Handle<Red::questQuestPhaseResource>& aPhaseResource)
+{
+    return aPhaseResource->path == HiddenPrefabActivityResource;
+}
+
+bool App::QuestPhaseRegistry::ApplyActivityBugfixes(const App::QuestPhaseGraphAccessor& aPhaseGraphAccessor,
+                                                    const Red::Handle<Red::questQuestPhaseResource>& aPhaseResource,
+                                                    Red::Handle<Red::questGraphDefinition>& aPhaseGraph)
+{
+    if (aPhaseResource->path == HiddenPrefabActivityResource)
+    {
+        for (const auto& prefabNodeType : aPhaseGraphAccessor.GetNodeTypesOfType<Red::questShowWorldNode_NodeType>())
+        {
+            prefabNodeType->show = false;
+        }
 
         return true;
     }
@@ -222,33 +531,32 @@ bool App::QuestPhaseRegistry::ApplyActivityBugfixes(App::QuestPhaseGraphAccessor
     return false;
 }
 
-bool App::QuestPhaseRegistry::RegisterMinorActivity(App::QuestPhaseGraphAccessor& aPhaseGraphAccessor,
-                                                    Red::questPhaseInstance* aPhase,
-                                                    const Red::Handle<Red::questQuestPhaseResource>& aPhaseResource,
-                                                    Red::Handle<Red::questGraphDefinition>& aPhaseGraph,
-                                                    const Red::QuestNodePath& aPhaseNodePath)
+Core::SharedPtr<App::ActivityDefinition> App::QuestPhaseRegistry::ScanMinorActivity(
+    const App::QuestPhaseGraphAccessor& aPhaseGraphAccessor, Red::questPhaseInstance* aPhase,
+    const Red::Handle<Red::questQuestPhaseResource>& aPhaseResource, Red::Handle<Red::questGraphDefinition>& aPhaseGraph,
+    const Red::QuestNodePath& aPhaseNodePath)
 {
     auto inputNode = aPhaseGraphAccessor.FindInputNode();
 
     if (!inputNode)
-        return false;
+        return {};
 
     auto poiMappin = aPhaseGraphAccessor.FindCompletedPointOfInterestMappin();
 
     if (!poiMappin)
-        return false;
+        return {};
 
     auto activityName = ExtractMinorActivityName(poiMappin->path->realPath);
 
     if (!activityName)
-        return false;
+        return {};
 
     auto communities = aPhaseGraphAccessor.FindCommunities();
     auto spawnSets = aPhaseGraphAccessor.FindSpawnSets();
     auto spawners = aPhaseGraphAccessor.FindSpawners();
 
     if (communities.empty() && spawnSets.empty() && spawners.empty())
-        return false;
+        return {};
 
     auto activity = Core::MakeShared<ActivityDefinition>();
 
@@ -257,25 +565,6 @@ bool App::QuestPhaseRegistry::RegisterMinorActivity(App::QuestPhaseGraphAccessor
 
     activity->mappinHash = Red::Murmur3_32(poiMappin->path->realPath.c_str());
 
-    {
-        auto journalManager = Red::GetGameSystem<Red::gameIJournalManager>();
-        Raw::JournalManager::GetEntryByHash(journalManager, activity->mappinEntry, activity->mappinHash);
-
-        if (!activity->mappinEntry)
-            return false;
-
-        auto& mappinData = Red::Cast<Red::gamemappinsPhaseVariant>(activity->mappinEntry->mappinData.typedVariant);
-
-        if (!mappinData || !IsCombatActivityVariant(mappinData->variant))
-            return false;
-
-        Red::CallGlobal("gameuiMappinUIUtils::MappinToString;gamedataMappinVariant", activity->title, mappinData->variant);
-        Red::CallGlobal("gameuiMappinUIUtils::MappinToDescriptionString;gamedataMappinVariant", activity->description, mappinData->variant);
-    }
-
-    activity->district = DistrictResolver::GetDistrict(activity->name);
-    activity->area = DistrictResolver::GetArea(activity->name);
-
     for (const auto& community : communities)
     {
         activity->communityRefs.push_back({community->spawnerReference, community->communityEntryName});
@@ -336,56 +625,98 @@ bool App::QuestPhaseRegistry::RegisterMinorActivity(App::QuestPhaseGraphAccessor
     {
         activity->lootContainerRef = lootContainer->objectRef;
         activity->persistenceRefs.push_back({lootContainer->objectRef});
+    }
+
+    GenerateResetNodes(aPhaseGraphAccessor, aPhaseResource, activity->resetNodes);
+
+    activity->phaseInstance = aPhase;
+    activity->phaseGraph = aPhaseGraph;
+    activity->phaseResource = aPhaseResource;
+    activity->phaseNodeKey = aPhaseNodePath;
+    activity->phaseNodePath = aPhaseNodePath;
+
+    activity->inputNode = inputNode;
+    activity->inputSocket = {inputNode->socketName};
+    activity->inputNodeKey = {aPhaseNodePath, inputNode->id};
+
+    return activity;
+}
+
+bool App::QuestPhaseRegistry::ResolveMinorActivity(const Core::SharedPtr<ActivityDefinition>& aActivity)
+{
+    auto phaseGraph = aActivity->phaseGraph.Lock();
+    auto inputNode = aActivity->inputNode.Lock();
+
+    if (!phaseGraph || !inputNode)
+        return false;
+
+    {
+        auto journalManager = Red::GetGameSystem<Red::gameIJournalManager>();
+        Raw::JournalManager::GetEntryByHash(journalManager, aActivity->mappinEntry, aActivity->mappinHash);
+
+        if (!aActivity->mappinEntry)
+            return false;
+
+        auto& mappinData = Red::Cast<Red::gamemappinsPhaseVariant>(aActivity->mappinEntry->mappinData.typedVariant);
+
+        if (!mappinData || !IsCombatActivityVariant(mappinData->variant))
+            return false;
 
-        if (activity->lootItemIDs.empty())
+        Red::CallGlobal("gameuiMappinUIUtils::MappinToString;gamedataMappinVariant", aActivity->title, mappinData->variant);
+        Red::CallGlobal("gameuiMappinUIUtils::MappinToDescriptionString;gamedataMappinVariant", aActivity->description, mappinData->variant);
+    }
+
+    aActivity->district = DistrictResolver::GetDistrict(aActivity->name);
+    aActivity->area = DistrictResolver::GetArea(aActivity->name);
+
+    if (aActivity->lootContainerRef && aActivity->lootItemIDs.empty())
+    {
+        for (const auto& suffix : {"_shard", "_onscreen", "_onscreen_01", "_onscreen_02"})
         {
-            for (const auto& suffix : {"_shard", "_onscreen", "_onscreen_01", "_onscreen_02"})
+            Red::TweakDBID readableID(std::string("Items.") + aActivity->name.ToString() + suffix);
+            if (Red::RecordExists(readableID))
             {
-                Red::TweakDBID readableID(std::string("Items.") + activityName.ToString() + suffix);
-                if (Red::RecordExists(readableID))
-                {
-                    activity->lootItemIDs.push_back(readableID);
-                    break;
-                }
+                aActivity->lootItemIDs.push_back(readableID);
+                break;
             }
         }
     }
 
     for (const auto& suffix : {"_dvc_sec_sys", "_dvc_sec_system", "_dvc_security_system"})
     {
-        Red::NodeRef securitySystemRef{Red::FNV1a64(suffix, activityName)};
+        Red::NodeRef securitySystemRef{Red::FNV1a64(suffix, aActivity->name)};
 
         if (Red::ResolveNodeRef(securitySystemRef))
         {
-            activity->securitySystemRef = securitySystemRef;
+            aActivity->securitySystemRef = securitySystemRef;
 
-            activity->persistenceRefs.push_back({securitySystemRef});
-            activity->persistenceRefs.push_back({securitySystemRef, "controller"});
-            activity->persistenceRefs.push_back({securitySystemRef, "master"});
+            aActivity->persistenceRefs.push_back({securitySystemRef});
+            aActivity->persistenceRefs.push_back({securitySystemRef, "controller"});
+            aActivity->persistenceRefs.push_back({securitySystemRef, "master"});
 
 #ifndef NDEBUG
-            LogDebug("SecuritySystem: {}{}", activityName.ToString(), suffix);
+            LogDebug("SecuritySystem: {}{}", aActivity->name.ToString(), suffix);
 #endif
             break;
         }
     }
 
     {
-        QuestPhaseGraphBuilder phaseGraphBuilder{aPhaseGraph};
+        QuestPhaseGraphBuilder phaseGraphBuilder{phaseGraph};
 
-        if (activity->lootContainerRef)
+        if (aActivity->lootContainerRef)
         {
-            auto pauseNode = phaseGraphBuilder.AddStaticEntitySpawnWait(activity->lootContainerRef);
-            auto eventNode = phaseGraphBuilder.AddEventDispatch(activity->lootContainerRef);
+            auto pauseNode = phaseGraphBuilder.AddStaticEntitySpawnWait(aActivity->lootContainerRef);
+            auto eventNode = phaseGraphBuilder.AddEventDispatch(aActivity->lootContainerRef);
             eventNode->event = Red::MakeHandle<Red::gameResetContainerEvent>();
 
             phaseGraphBuilder.AddConnection(inputNode, pauseNode);
             phaseGraphBuilder.AddConnection(pauseNode, eventNode);
         }
 
-        if (activity->securitySystemRef)
+        if (aActivity->securitySystemRef)
         {
-            auto eventNode = phaseGraphBuilder.AddEventDispatch(activity->securitySystemRef);
+            auto eventNode = phaseGraphBuilder.AddEventDispatch(aActivity->securitySystemRef);
             eventNode->event = Red::MakeHandle<ResetSecuritySystemNetwork>();
             eventNode->PSClassName = "SecuritySystemControllerPS";
             eventNode->componentName = "controller";
@@ -394,29 +725,58 @@ bool App::QuestPhaseRegistry::RegisterMinorActivity(App::QuestPhaseGraphAccessor
         }
     }
 
-    GenerateResetNodes(aPhaseGraphAccessor, aPhaseResource, activity->resetNodes);
+    return true;
+}
 
-    activity->phaseInstance = aPhase;
-    activity->phaseGraph = aPhaseGraph;
-    activity->phaseResource = aPhaseResource;
-    activity->phaseNodeKey = aPhaseNodePath;
-    activity->phaseNodePath = aPhaseNodePath;
+void App::QuestPhaseRegistry::RegisterMinorActivity(const Core::SharedPtr<ActivityDefinition>& aActivity)
+{
+    for (const auto& factID : aActivity->namedFacts)
+    {
+        s_activitiesByFacts[factID].push_back(aActivity->name);
+    }
 
-    activity->inputNode = inputNode;
-    activity->inputSocket = {inputNode->socketName};
-    activity->inputNodeKey = {aPhaseNodePath, inputNode->id};
+    auto it = s_activities.find(aActivity->name);
+    if (it != s_activities.end())
+    {
+        UnindexActivity(it.value());
+        it.value() = aActivity;
+    }
+    else
+    {
+        s_activities.insert({aActivity->name, aActivity});
+    }
 
-    for (const auto& factID : activity->namedFacts)
+    IndexActivity(aActivity);
+}
+
+void App::QuestPhaseRegistry::IndexActivity(const Core::SharedPtr<ActivityDefinition>& aActivity)
+{
+    s_activitiesByKind[aActivity->kind].push_back(aActivity);
+    s_activitiesByDistrict[aActivity->district].push_back(aActivity);
+
+    if (aActivity->area != aActivity->district)
     {
-        s_activitiesByFacts[factID].push_back(activity->name);
+        s_activitiesByDistrict[aActivity->area].push_back(aActivity);
     }
+}
 
-    s_activities[activity->name] = std::move(activity);
+void App::QuestPhaseRegistry::UnindexActivity(const Core::SharedPtr<ActivityDefinition>& aActivity)
+{
+    if (auto it = s_activitiesByKind.find(aActivity->kind); it != s_activitiesByKind.end())
+    {
+        std::erase(it.value(), aActivity);
+    }
 
-    return true;
+    for (const auto district : {aActivity->district, aActivity->area})
+    {
+        if (auto it = s_activitiesByDistrict.find(district); it != s_activitiesByDistrict.end())
+        {
+            std::erase(it.value(), aActivity);
+        }
+    }
 }
 
-bool App::QuestPhaseRegistry::RegisterCyberpsychoActivity(App::QuestPhaseGraphAccessor& aPhaseGraphAccessor,
+bool App::QuestPhaseRegistry::RegisterCyberpsychoActivity(const App::QuestPhaseGraphAccessor& aPhaseGraphAccessor,
                                                           Red::questPhaseInstance* aPhase,
                                                           const Red::Handle<Red::questGraphDefinition>& aPhaseGraph,
                                                           const Red::QuestNodePath& aParentPath, Red::QuestNodeID aPhaseNodeID)
@@ -441,7 +801,7 @@ bool App::QuestPhaseRegistry::RegisterCyberpsychoActivity(App::QuestPhaseGraphAc
     return false;
 }
 
-void App::QuestPhaseRegistry::GenerateResetNodes(App::QuestPhaseGraphAccessor& aPhaseGraphAccessor,
+void App::QuestPhaseRegistry::GenerateResetNodes(const App::QuestPhaseGraphAccessor& aPhaseGraphAccessor,
                                                  const Red::Handle<Red::questQuestPhaseResource>& aPhaseResource,
                                                  Core::Vector<Red::Handle<Red::questNodeDefinition>>& aResetNodes)
 {
@@ -480,6 +840,7 @@ void App::QuestPhaseRegistry::GenerateResetNodes(App::QuestPhaseGraphAccessor& a
         }
     }
 
+    // Toggles and shows are reset in the order they appear in the graph
     for (const auto& prefabNode : aPhaseGraphAccessor.GetNodesOfType<Red::questWorldDataManagerNodeDefinition>())
     {
         if (auto& prefabNodeType = Red::Cast<Red::questTogglePrefabVariant_NodeType>(prefabNode->type))
@@ -654,6 +1015,60 @@ Core::SharedPtr<App::ActivityDefinition> App::QuestPhaseRegistry::FindActivity(R
     return it.value();
 }
 
+Core::Vector<Core::SharedPtr<App::ActivityDefinition>> App::QuestPhaseRegistry::FindActivities(
+    Red::CName aKind, const Red::DynArray<Red::gamedataDistrict>& aDistricts)
+{
+    std::shared_lock activitiesLockR(s_activitiesLock);
+    Core::Vector<Core::SharedPtr<App::ActivityDefinition>> activities;
+
+    if (aDistricts.size > 0)
+    {
+        Core::Set<ActivityDefinition*> visited;
+
+        for (const auto& district : aDistricts)
+        {
+            const auto& it = s_activitiesByDistrict.find(district);
+
+            if (it == s_activitiesByDistrict.end())
+                continue;
+
+            for (const auto& activity : it.value())
+            {
+                if (aKind && activity->kind != aKind)
+                    continue;
+
+                if (visited.insert(activity.get()).second)
+                {
+                    activities.push_back(activity);
+                }
+            }
+        }
+
+        return activities;
+    }
+
+    if (aKind)
+    {
+        const auto& it = s_activitiesByKind.find(aKind);
+
+        if (it != s_activitiesByKind.end())
+        {
+            activities = it.value();
+        }
+
+        return activities;
+    }
+
+    activities.reserve(s_activities.size());
+
+    for (const auto& [_, activity] : s_activities)
+    {
+        activities.push_back(activity);
+    }
+
+    return activities;
+}
+
 void App::QuestPhaseRegistry::DumpActivities()
 {
 #ifndef NDEBUG
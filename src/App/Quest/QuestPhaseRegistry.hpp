@@ -80,17 +80,49 @@ class QuestPhaseRegistry
     , public Core::LoggingAgent
 {
 public:
+    explicit QuestPhaseRegistry(const std::filesystem::path& aCachePath);
+
     bool PhasesInitialized();
     Red::questPhaseInstance* GetPhaseInstance(Red::QuestNodePathHash aPhasePathHash);
 
     bool ActivitiesInitialized();
+    float GetActivitiesProgress();
     void InitializeActivities();
+    void FinalizeActivities();
     Core::Vector<Core::SharedPtr<ActivityDefinition>> GetAllActivities();
     Core::Vector<Red::CName> GetAllActivityNames();
     Core::SharedPtr<ActivityDefinition> FindActivity(Red::CName aName);
+    Core::Vector<Core::SharedPtr<ActivityDefinition>> FindActivities(
+        Red::CName aKind, const Red::DynArray<Red::gamedataDistrict>& aDistricts);
     void DumpActivities();
 
 protected:
+    struct PhaseScan
+    {
+        Red::Handle<Red::questPhaseInstance> phase;
+        bool minorActivity;
+        bool bugfixes;
+        bool cached;
+        bool restored;
+        uint64_t cachedHash;
+        uint64_t contentHash;
+        Red::QuestNodeID inputNodeID;
+        Core::SharedPtr<ActivityDefinition> activity;
+        Core::Vector<std::string> factNames;
+    };
+
+    struct PhaseScanBatch
+    {
+        Core::Vector<PhaseScan> scans;
+        std::atomic<uint32_t> pending;
+        uint32_t generation;
+        uint64_t build;
+        uint64_t fingerprint;
+        uint32_t cachedCount;
+    };
+
+    using PhaseScanBatchPtr = Core::SharedPtr<PhaseScanBatch>;
+
     void OnBootstrap() override;
     static void OnPhasePreloadCheck(bool& aPreload, void* aLoader, const Red::QuestNodePath& aPhaseNodePath);
     static void OnInitializePhase(Red::questPhaseInstance* aPhase, Red::QuestContext& aContext,
@@ -98,19 +130,30 @@ protected:
                                   Red::Handle<Red::questGraphDefinition>& aPhaseGraph,
                                   const Red::QuestNodePath& aParentNodePath, Red::QuestNodeID aPhaseNodeID);
 
-    static bool ApplyActivityBugfixes(App::QuestPhaseGraphAccessor& aPhaseGraphAccessor,
+    static bool HasActivityBugfixes(const Red::Handle<Red::questQuestPhaseResource>& aPhaseResource);
+    static bool ApplyActivityBugfixes(const App::QuestPhaseGraphAccessor& aPhaseGraphAccessor,
                                       const Red::Handle<Red::questQuestPhaseResource>& aPhaseResource,
                                       Red::Handle<Red::questGraphDefinition>& aPhaseGraph);
-    static bool RegisterMinorActivity(QuestPhaseGraphAccessor& aPhaseGraphAccessor,
-                                      Red::questPhaseInstance* aPhase,
-                                      const Red::Handle<Red::questQuestPhaseResource>& aPhaseResource,
-                                      Red::Handle<Red::questGraphDefinition>& aPhaseGraph,
-                                      const Red::QuestNodePath& aPhaseNodePath);
-    static bool RegisterCyberpsychoActivity(QuestPhaseGraphAccessor& aPhaseGraphAccessor,
+    static void ScanPhase(const PhaseScanBatchPtr& aBatch, uint32_t aIndex);
+    static void ScanBugfixedPhase(PhaseScan& aScan);
+    static void MergePhaseScans(const PhaseScanBatchPtr& aBatch);
+    static void LoadPhaseScans(const PhaseScanBatchPtr& aBatch);
+    static bool RestorePhaseScan(PhaseScan& aScan);
+    static void StorePhaseScans(const PhaseScanBatchPtr& aBatch);
+
+    static Core::SharedPtr<ActivityDefinition> ScanMinorActivity(
+        const QuestPhaseGraphAccessor& aPhaseGraphAccessor, Red::questPhaseInstance* aPhase,
+        const Red::Handle<Red::questQuestPhaseResource>& aPhaseResource,
+        Red::Handle<Red::questGraphDefinition>& aPhaseGraph, const Red::QuestNodePath& aPhaseNodePath);
+    static bool ResolveMinorActivity(const Core::SharedPtr<ActivityDefinition>& aActivity);
+    static void RegisterMinorActivity(const Core::SharedPtr<ActivityDefinition>& aActivity);
+    static void IndexActivity(const Core::SharedPtr<ActivityDefinition>& aActivity);
+    static void UnindexActivity(const Core::SharedPtr<ActivityDefinition>& aActivity);
+    static bool RegisterCyberpsychoActivity(const QuestPhaseGraphAccessor& aPhaseGraphAccessor,
                                             Red::questPhaseInstance* aPhase,
                                             const Red::Handle<Red::questGraphDefinition>& aPhaseGraph,
                                             const Red::QuestNodePath& aParentPath, Red::QuestNodeID aPhaseNodeID);
-    static void GenerateResetNodes(QuestPhaseGraphAccessor& aPhaseGraphAccessor,
+    static void GenerateResetNodes(const QuestPhaseGraphAccessor& aPhaseGraphAccessor,
                                    const Red::Handle<Red::questQuestPhaseResource>& aPhaseResource,
                                    Core::Vector<Red::Handle<Red::questNodeDefinition>>& aResetNodes);
 
@@ -119,16 +162,26 @@ protected:
     static bool IsCombatActivityVariant(Red::gamedataMappinVariant aVariant);
 
 private:
+    inline static std::filesystem::path s_cachePath;
+
     inline static std::shared_mutex s_phasesLock;
     inline static Core::Map<Red::QuestNodePathHash, Red::WeakHandle<Red::questPhaseInstance>> s_phases;
     inline static bool s_phasesReady;
 
     inline static std::shared_mutex s_activitiesLock;
     inline static Core::Map<Red::CName, Core::SharedPtr<ActivityDefinition>> s_activities;
+    inline static Core::Map<Red::CName, Core::Vector<Core::SharedPtr<ActivityDefinition>>> s_activitiesByKind;
+    inline static Core::Map<Red::gamedataDistrict, Core::Vector<Core::SharedPtr<ActivityDefinition>>> s_activitiesByDistrict;
     inline static Core::Map<uint64_t, Core::SharedPtr<PopulationDefinition>> s_populations;
     inline static Core::Map<uint32_t, Core::Vector<Red::CName>> s_activitiesByFacts;
     inline static Core::Map<uint32_t, Core::Vector<uint64_t>> s_populationsByFacts;
     inline static Core::Map<Red::ResourcePath, Red::QuestNodePath> s_openWorldPhaseNodePaths;
     inline static bool s_activitiesReady;
+    inline static uint32_t s_activitiesGeneration;
+    inline static std::atomic<bool> s_activitiesLoading;
+    inline static std::atomic<uint32_t> s_activitiesScanned;
+    inline static std::atomic<uint32_t> s_activitiesTotal;
+    inline static std::mutex s_pendingScansLock;
+    inline static PhaseScanBatchPtr s_pendingScans;
 };
 }
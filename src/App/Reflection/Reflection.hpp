@@ -2,6 +2,7 @@
 
 #include "ReflectionClass.hpp"
 #include "ReflectionEnum.hpp"
+#include "ReflectionIndex.hpp"
 #include "ReflectionType.hpp"
 
 namespace
@@ -19,17 +20,7 @@ struct Reflection
         if (aVariant.IsEmpty())
             return {};
 
-        auto type = aVariant.GetType();
-
-        switch (type->GetType())
-        {
-        case Red::ERTTIType::Class:
-            return Red::MakeHandle<ReflectionClass>(reinterpret_cast<Red::CClass*>(type));
-        case Red::ERTTIType::Enum:
-            return Red::MakeHandle<ReflectionEnum>(reinterpret_cast<Red::CEnum*>(type));
-        default:
-            return Red::MakeHandle<ReflectionType>(type);
-        }
+        return ReflectionIndex::Get()->GetTypeWrapper(aVariant.GetType());
     }
 
      static Red::Handle<ReflectionClass> GetClassOf(const Red::Variant& aVariant, Red::Optional<bool, true> aActualType)
@@ -63,12 +54,12 @@ struct Reflection
         if (!resolvedClass)
             return {};
 
-        if (aActualType && resolvedClass->IsA(s_serializableType))
+        if (aActualType && Red::IsA(resolvedClass, s_serializableType))
         {
             resolvedClass = reinterpret_cast<Red::ISerializable*>(resolvedInstance)->GetType();
         }
 
-        return Red::MakeHandle<ReflectionClass>(resolvedClass);
+        return ReflectionIndex::Get()->GetClassWrapper(resolvedClass);
     }
 
     static Red::Handle<ReflectionType> GetType(Red::CName aName)
@@ -79,15 +70,7 @@ struct Reflection
         if (!type)
             return {};
 
-        switch (type->GetType())
-        {
-        case Red::ERTTIType::Class:
-            return Red::MakeHandle<ReflectionClass>(reinterpret_cast<Red::CClass*>(type));
-        case Red::ERTTIType::Enum:
-            return Red::MakeHandle<ReflectionEnum>(reinterpret_cast<Red::CEnum*>(type));
-        default:
-            return Red::MakeHandle<ReflectionType>(type);
-        }
+        return ReflectionIndex::Get()->GetTypeWrapper(type);
     }
 
     static Red::Handle<ReflectionClass> GetClass(Red::CName aName)
@@ -98,7 +81,7 @@ struct Reflection
         if (!type)
             return {};
 
-        return Red::MakeHandle<ReflectionClass>(type);
+        return ReflectionIndex::Get()->GetClassWrapper(type);
     }
 
     static Red::Handle<ReflectionEnum> GetEnum(Red::CName aName)
@@ -109,7 +92,7 @@ struct Reflection
         if (!type)
             return {};
 
-        return Red::MakeHandle<ReflectionEnum>(type);
+        return ReflectionIndex::Get()->GetEnumWrapper(type);
     }
 
     static Red::Handle<ReflectionStaticFunc> GetGlobalFunction(Red::CName aName)
@@ -120,34 +103,17 @@ struct Reflection
         if (!func)
             return {};
 
-        return Red::MakeHandle<ReflectionStaticFunc>(func);
+        return ReflectionIndex::Get()->GetGlobalFunctionWrapper(func);
     }
 
     static Red::DynArray<Red::Handle<ReflectionType>> GetTypes()
     {
-        Red::DynArray<Red::Handle<ReflectionType>> wrappers;
-
-        auto rtti = Red::CRTTISystem::Get();
-        rtti->types.ForEach([&wrappers](Red::CName, Red::CBaseRTTIType* aType) {
-            wrappers.PushBack(Red::MakeHandle<ReflectionType>(aType));
-        });
-
-        return wrappers;
+        return ReflectionIndex::Get()->GetTypes();
     }
 
     static Red::DynArray<Red::Handle<ReflectionClass>> GetClasses()
     {
-        Red::DynArray<Red::Handle<ReflectionClass>> wrappers;
-
-        auto rtti = Red::CRTTISystem::Get();
-        rtti->types.ForEach([&wrappers](Red::CName, Red::CBaseRTTIType* aType) {
-            if (aType->GetType() == Red::ERTTIType::Class)
-            {
-                wrappers.PushBack(Red::MakeHandle<ReflectionClass>(reinterpret_cast<Red::CClass*>(aType)));
-            }
-        });
-
-        return wrappers;
+        return ReflectionIndex::Get()->GetClasses();
     }
 
     static Red::DynArray<Red::Handle<ReflectionClass>> GetDerivedClasses(Red::CName aBase)
@@ -158,43 +124,17 @@ struct Reflection
         if (!base)
             return {};
 
-        Red::DynArray<Red::Handle<ReflectionClass>> wrappers;
-        Red::DynArray<Red::CClass*> classes;
-        rtti->GetClasses(base, classes, nullptr, true);
-
-        for (const auto& derived : classes)
-        {
-            wrappers.PushBack(Red::MakeHandle<ReflectionClass>(derived));
-        }
-
-        return wrappers;
+        return ReflectionIndex::Get()->GetDerivedClasses(base);
     }
 
     static Red::DynArray<Red::Handle<ReflectionEnum>> GetEnums()
     {
-        Red::DynArray<Red::Handle<ReflectionEnum>> wrappers;
-
-        auto rtti = Red::CRTTISystem::Get();
-        rtti->types.ForEach([&wrappers](Red::CName, Red::CBaseRTTIType* aType) {
-            if (aType->GetType() == Red::ERTTIType::Enum)
-            {
-                wrappers.PushBack(Red::MakeHandle<ReflectionEnum>(reinterpret_cast<Red::CEnum*>(aType)));
-            }
-        });
-
-        return wrappers;
+        return ReflectionIndex::Get()->GetEnums();
     }
 
     static Red::DynArray<Red::Handle<ReflectionStaticFunc>> GetGlobalFunctions()
     {
-        Red::DynArray<Red::Handle<ReflectionStaticFunc>> wrappers;
-
-        auto rtti = Red::CRTTISystem::Get();
-        rtti->funcs.ForEach([&wrappers](Red::CName, Red::CGlobalFunction* aFunc) {
-            wrappers.PushBack(Red::MakeHandle<ReflectionStaticFunc>(aFunc));
-        });
-
-        return wrappers;
+        return ReflectionIndex::Get()->GetGlobalFunctions();
     }
 };
 }
@@ -61,70 +61,126 @@ struct ReflectionFunc : Red::IScriptable
     {
         Red::Variant ret;
 
-        if (aArgs->size != m_func->params.size)
+        const auto success = Invoke(aContext, aArgs, ret, aFrame);
+
+        if (aStatus)
         {
-            if (aStatus)
+            aStatus = success;
+        }
+
+        return ret;
+    }
+
+protected:
+    struct CallPlan
+    {
+        explicit CallPlan(Red::CBaseFunction* aFunc)
+            : paramTypes(aFunc->params.size)
+            , argTypes(aFunc->params.size)
+            , args(aFunc->params.size)
+            , returnType(aFunc->returnType ? aFunc->returnType->type : nullptr)
+            , contextType(aFunc->flags.isStatic ? nullptr : reinterpret_cast<Red::CClassFunction*>(aFunc)->parent)
+        {
+            for (uint32_t i = 0; i < aFunc->params.size; ++i)
             {
-                aStatus = false;
+                paramTypes[i] = aFunc->params[i]->type;
+                argTypes[i] = aFunc->params[i]->type;
             }
-
-            return ret;
         }
 
-        if (!m_func->flags.isStatic)
+        Core::Vector<Red::CBaseRTTIType*> paramTypes;
+        Core::Vector<std::atomic<Red::CBaseRTTIType*>> argTypes;
+        Red::StackArgs_t args;
+        Red::CBaseRTTIType* returnType;
+        Red::CClass* contextType;
+        std::atomic_flag argsInUse;
+    };
+
+    // The plan is built on first call, argument types that passed the type check
+    // are remembered, so repeated calls with the same types only compare pointers
+    [[nodiscard]] CallPlan& GetCallPlan() const
+    {
+        std::call_once(m_planFlag, [this]() {
+            m_plan = Core::MakeUnique<CallPlan>(m_func);
+        });
+
+        return *m_plan;
+    }
+
+    bool Invoke(Red::IScriptable* aContext, const Red::DynArray<Red::Variant>& aArgs, Red::Variant& aResult,
+                Red::CStackFrame* aFrame) const
+    {
+        auto& plan = GetCallPlan();
+
+        if (aArgs.size != plan.paramTypes.size())
+            return false;
+
+        if (plan.contextType && (!aContext || !aContext->GetType()->IsA(plan.contextType)))
+            return false;
+
+        for (uint32_t i = 0; i < aArgs.size; ++i)
         {
-            const auto& func = reinterpret_cast<Red::CClassFunction*>(m_func);
+            auto* argType = aArgs.entries[i].GetType();
 
-            if (!aContext || !aContext->GetType()->IsA(func->parent))
-            {
-                if (aStatus)
-                {
-                    aStatus = false;
-                }
+            if (argType == plan.argTypes[i].load(std::memory_order_relaxed))
+                continue;
 
-                return ret;
+            // A type that is compatible on its own is compatible for any value,
+            // otherwise the value decides, e.g. when passing a handle of the base class
+            if (Red::IsCompatible(plan.paramTypes[i], argType))
+            {
+                plan.argTypes[i].store(argType, std::memory_order_relaxed);
+                continue;
             }
+
+            if (!Red::IsCompatible(plan.paramTypes[i], argType, aArgs.entries[i].GetDataPtr()))
+                return false;
         }
 
-        Red::StackArgs_t args(m_func->params.size);
-        Red::CStackType result;
-        Red::CStack stack(aContext, args.data(), args.size(), &result);
+        // The preallocated stack is only used by one call at a time,
+        // nested or concurrent calls of the same function get their own
+        const auto usePlanArgs = !plan.argsInUse.test_and_set(std::memory_order_acquire);
+
+        Red::StackArgs_t localArgs;
 
-        for (uint32_t i = 0; i < m_func->params.size; ++i)
+        if (!usePlanArgs)
         {
-            if (!Red::IsCompatible(m_func->params[i]->type, aArgs->entries[i].GetType(), aArgs->entries[i].GetDataPtr()))
-            {
-                if (aStatus)
-                {
-                    aStatus = false;
-                }
+            localArgs.resize(aArgs.size);
+        }
 
-                return ret;
-            }
+        auto& args = usePlanArgs ? plan.args : localArgs;
+
+        Red::CStackType result;
+        Red::CStack stack(aContext, args.data(), static_cast<uint32_t>(args.size()), &result);
 
-            stack.args[i].type = aArgs->entries[i].GetType();
-            stack.args[i].value = aArgs->entries[i].GetDataPtr();
+        for (uint32_t i = 0; i < aArgs.size; ++i)
+        {
+            stack.args[i].type = aArgs.entries[i].GetType();
+            stack.args[i].value = aArgs.entries[i].GetDataPtr();
         }
 
-        if (m_func->returnType)
+        if (plan.returnType)
         {
-            ret.Init(m_func->returnType->type);
+            aResult.Init(plan.returnType);
 
-            stack.result->type = ret.GetType();
-            stack.result->value = ret.GetDataPtr();
+            stack.result->type = aResult.GetType();
+            stack.result->value = aResult.GetDataPtr();
         }
 
         const auto success = Red::CallFunction(aFrame, m_func, stack);
 
-        if (aStatus)
+        if (usePlanArgs)
         {
-            aStatus = success;
+            plan.argsInUse.clear(std::memory_order_release);
         }
 
-        return ret;
+        return success;
     }
 
+public:
     Red::CBaseFunction* m_func;
+    mutable std::once_flag m_planFlag;
+    mutable Core::UniquePtr<CallPlan> m_plan;
 
     RTTI_IMPL_TYPEINFO(App::ReflectionFunc);
     RTTI_IMPL_ALLOCATOR();
@@ -142,6 +198,36 @@ struct ReflectionMemberFunc : ReflectionFunc
         return ReflectionFunc::Call(aContext.GetPtr(), aArgs, aStatus, aFrame);
     }
 
+    Red::DynArray<Red::Variant> CallMany(const Red::DynArray<Red::Handle<Red::IScriptable>>& aContexts,
+                                         Red::Optional<Red::DynArray<Red::Variant>>& aArgs,
+                                         Red::Optional<Red::ScriptRef<bool>>& aStatus,
+                                         Red::CStackFrame* aFrame)
+    {
+        Red::DynArray<Red::Variant> results;
+        results.Reserve(aContexts.size);
+
+        auto success = true;
+
+        for (const auto& context : aContexts)
+        {
+            Red::Variant ret;
+
+            if (!Invoke(context.GetPtr(), aArgs, ret, aFrame))
+            {
+                success = false;
+            }
+
+            results.PushBack(std::move(ret));
+        }
+
+        if (aStatus)
+        {
+            aStatus = success;
+        }
+
+        return results;
+    }
+
     RTTI_IMPL_TYPEINFO(App::ReflectionMemberFunc);
     RTTI_IMPL_ALLOCATOR();
 };
@@ -174,6 +260,7 @@ RTTI_DEFINE_CLASS(App::ReflectionFunc, {
 RTTI_DEFINE_CLASS(App::ReflectionMemberFunc, {
     RTTI_PARENT(App::ReflectionFunc);
     RTTI_METHOD(Call);
+    RTTI_METHOD(CallMany);
 });
 
 RTTI_DEFINE_CLASS(App::ReflectionStaticFunc, {
@@ -0,0 +1,189 @@
+#include "ReflectionIndex.hpp"
+
+namespace
+{
+std::shared_mutex s_indexLock;
+Core::SharedPtr<const App::ReflectionIndex> s_index;
+uint32_t s_indexGeneration;
+std::atomic<uint32_t> s_scriptsGeneration;
+
+uint32_t GetCurrentGeneration()
+{
+    return Red::TypeInfoRegistrar::GetGeneration() + s_scriptsGeneration.load(std::memory_order_acquire);
+}
+}
+
+Core::SharedPtr<const App::ReflectionIndex> App::ReflectionIndex::Get()
+{
+    const auto generation = GetCurrentGeneration();
+
+    {
+        std::shared_lock _(s_indexLock);
+
+        if (s_index && s_indexGeneration == generation)
+            return s_index;
+    }
+
+    std::unique_lock _(s_indexLock);
+
+    if (!s_index || s_indexGeneration != generation)
+    {
+        auto index = Core::MakeShared<ReflectionIndex>();
+        index->Build();
+
+        s_index = std::move(index);
+        s_indexGeneration = generation;
+    }
+
+    return s_index;
+}
+
+void App::ReflectionIndex::Invalidate()
+{
+    ++s_scriptsGeneration;
+}
+
+void App::ReflectionIndex::Build()
+{
+    auto rtti = Red::CRTTISystem::Get();
+
+    rtti->types.ForEach([this](Red::CName, Red::CBaseRTTIType* aType) {
+        m_typeIndex.emplace(aType, m_types.size);
+        m_types.PushBack(Red::MakeHandle<ReflectionType>(aType));
+
+        switch (aType->GetType())
+        {
+        case Red::ERTTIType::Class:
+        {
+            auto classType = reinterpret_cast<Red::CClass*>(aType);
+            m_classIndex.emplace(classType, m_classes.size);
+            m_classes.PushBack(Red::MakeHandle<ReflectionClass>(classType));
+            break;
+        }
+        case Red::ERTTIType::Enum:
+        {
+            auto enumType = reinterpret_cast<Red::CEnum*>(aType);
+            m_enumIndex.emplace(enumType, m_enums.size);
+            m_enums.PushBack(Red::MakeHandle<ReflectionEnum>(enumType));
+            break;
+        }
+        default: break;
+        }
+    });
+
+    rtti->funcs.ForEach([this](Red::CName, Red::CGlobalFunction* aFunc) {
+        m_globalFuncIndex.emplace(aFunc, m_globalFuncs.size);
+        m_globalFuncs.PushBack(Red::MakeHandle<ReflectionStaticFunc>(aFunc));
+    });
+
+    m_derivedClasses.resize(m_classes.size);
+
+    for (uint32_t i = 0; i < m_classes.size; ++i)
+    {
+        auto parent = m_classes[i]->m_class->parent;
+
+        if (!parent)
+            continue;
+
+        auto parentIt = m_classIndex.find(parent);
+
+        if (parentIt != m_classIndex.end())
+        {
+            m_derivedClasses[parentIt.value()].push_back(i);
+        }
+    }
+}
+
+const Red::DynArray<Red::Handle<App::ReflectionType>>& App::ReflectionIndex::GetTypes() const
+{
+    return m_types;
+}
+
+const Red::DynArray<Red::Handle<App::ReflectionClass>>& App::ReflectionIndex::GetClasses() const
+{
+    return m_classes;
+}
+
+const Red::DynArray<Red::Handle<App::ReflectionEnum>>& App::ReflectionIndex::GetEnums() const
+{
+    return m_enums;
+}
+
+const Red::DynArray<Red::Handle<App::ReflectionStaticFunc>>& App::ReflectionIndex::GetGlobalFunctions() const
+{
+    return m_globalFuncs;
+}
+
+Red::DynArray<Red::Handle<App::ReflectionClass>> App::ReflectionIndex::GetDerivedClasses(Red::CClass* aBase) const
+{
+    auto baseIt = m_classIndex.find(aBase);
+
+    if (baseIt == m_classIndex.end())
+        return {};
+
+    Red::DynArray<Red::Handle<ReflectionClass>> wrappers;
+    Core::Vector<uint32_t> pending{baseIt.value()};
+
+    while (!pending.empty())
+    {
+        const auto classIndex = pending.back();
+        pending.pop_back();
+
+        wrappers.PushBack(m_classes[classIndex]);
+
+        const auto& derivedClasses = m_derivedClasses[classIndex];
+        pending.insert(pending.end(), derivedClasses.rbegin(), derivedClasses.rend());
+    }
+
+    return wrappers;
+}
+
+Red::Handle<App::ReflectionType> App::ReflectionIndex::GetTypeWrapper(Red::CBaseRTTIType* aType) const
+{
+    switch (aType->GetType())
+    {
+    case Red::ERTTIType::Class:
+        return GetClassWrapper(reinterpret_cast<Red::CClass*>(aType));
+    case Red::ERTTIType::Enum:
+        return GetEnumWrapper(reinterpret_cast<Red::CEnum*>(aType));
+    default:
+    {
+        auto typeIt = m_typeIndex.find(aType);
+
+        if (typeIt == m_typeIndex.end())
+            return Red::MakeHandle<ReflectionType>(aType);
+
+        return m_types[typeIt.value()];
+    }
+    }
+}
+
+Red::Handle<App::ReflectionClass> App::ReflectionIndex::GetClassWrapper(Red::CClass* aClass) const
+{
+    auto classIt = m_classIndex.find(aClass);
+
+    if (classIt == m_classIndex.end())
+        return Red::MakeHandle<ReflectionClass>(aClass);
+
+    return m_classes[classIt.value()];
+}
+
+Red::Handle<App::ReflectionEnum> App::ReflectionIndex::GetEnumWrapper(Red::CEnum* aEnum) const
+{
+    auto enumIt = m_enumIndex.find(aEnum);
+
+    if (enumIt == m_enumIndex.end())
+        return Red::MakeHandle<ReflectionEnum>(aEnum);
+
+    return m_enums[enumIt.value()];
+}
+
+Red::Handle<App::ReflectionStaticFunc> App::ReflectionIndex::GetGlobalFunctionWrapper(Red::CBaseFunction* aFunc) const
+{
+    auto funcIt = m_globalFuncIndex.find(aFunc);
+
+    if (funcIt == m_globalFuncIndex.end())
+        return Red::MakeHandle<ReflectionStaticFunc>(aFunc);
+
+    return m_globalFuncs[funcIt.value()];
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "ReflectionClass.hpp"
+#include "ReflectionEnum.hpp"
+#include "ReflectionFunc.hpp"
+#include "ReflectionType.hpp"
+
+namespace App
+{
+// Snapshot of the type system with interned wrappers. The snapshot is immutable,
+// it's replaced when new types are registered or scripts are reloaded.
+class ReflectionIndex
+{
+public:
+    static Core::SharedPtr<const ReflectionIndex> Get();
+    static void Invalidate();
+
+    [[nodiscard]] const Red::DynArray<Red::Handle<ReflectionType>>& GetTypes() const;
+    [[nodiscard]] const Red::DynArray<Red::Handle<ReflectionClass>>& GetClasses() const;
+    [[nodiscard]] const Red::DynArray<Red::Handle<ReflectionEnum>>& GetEnums() const;
+    [[nodiscard]] const Red::DynArray<Red::Handle<ReflectionStaticFunc>>& GetGlobalFunctions() const;
+    [[nodiscard]] Red::DynArray<Red::Handle<ReflectionClass>> GetDerivedClasses(Red::CClass* aBase) const;
+
+    [[nodiscard]] Red::Handle<ReflectionType> GetTypeWrapper(Red::CBaseRTTIType* aType) const;
+    [[nodiscard]] Red::Handle<ReflectionClass> GetClassWrapper(Red::CClass* aClass) const;
+    [[nodiscard]] Red::Handle<ReflectionEnum> GetEnumWrapper(Red::CEnum* aEnum) const;
+    [[nodiscard]] Red::Handle<ReflectionStaticFunc> GetGlobalFunctionWrapper(Red::CBaseFunction* aFunc) const;
+
+private:
+    void Build();
+
+    Red::DynArray<Red::Handle<ReflectionType>> m_types;
+    Red::DynArray<Red::Handle<ReflectionClass>> m_classes;
+    Red::DynArray<Red::Handle<ReflectionEnum>> m_enums;
+    Red::DynArray<Red::Handle<ReflectionStaticFunc>> m_globalFuncs;
+    Core::Map<Red::CBaseRTTIType*, uint32_t> m_typeIndex;
+    Core::Map<Red::CClass*, uint32_t> m_classIndex;
+    Core::Map<Red::CEnum*, uint32_t> m_enumIndex;
+    Core::Map<Red::CBaseFunction*, uint32_t> m_globalFuncIndex;
+    Core::Vector<Core::Vector<uint32_t>> m_derivedClasses;
+};
+}
@@ -1,6 +1,98 @@
 #include "ScriptableServiceContainer.hpp"
+#include "Core/Hooking/HookingDriver.hpp"
 #include "Red/Serialization.hpp"
 
+namespace
+{
+constexpr auto SharedStateChunk = Red::CName{};
+
+void CollectStateObjects(Red::CBaseRTTIType* aType, void* aValue, Core::Set<void*>& aObjects);
+
+void CollectStateObjects(Red::ISerializable* aObject, Core::Set<void*>& aObjects)
+{
+    if (!aObject || !aObjects.insert(aObject).second)
+        return;
+
+    Red::DynArray<Red::CProperty*> props;
+    aObject->GetType()->GetProperties(props);
+
+    for (const auto& prop : props)
+    {
+        if (prop->flags.isPersistent)
+        {
+            CollectStateObjects(prop->type, prop->GetValuePtr<void>(aObject), aObjects);
+        }
+    }
+}
+
+void CollectStateObjects(Red::CBaseRTTIType* aType, void* aValue, Core::Set<void*>& aObjects)
+{
+    switch (aType->GetType())
+    {
+    case Red::ERTTIType::Handle:
+    {
+        CollectStateObjects(reinterpret_cast<Red::Handle<Red::ISerializable>*>(aValue)->instance, aObjects);
+        break;
+    }
+    case Red::ERTTIType::WeakHandle:
+    {
+        CollectStateObjects(reinterpret_cast<Red::WeakHandle<Red::ISerializable>*>(aValue)->instance, aObjects);
+        break;
+    }
+    case Red::ERTTIType::Array:
+    case Red::ERTTIType::StaticArray:
+    case Red::ERTTIType::NativeArray:
+    case Red::ERTTIType::FixedArray:
+    {
+        auto* arrayType = reinterpret_cast<Red::CRTTIBaseArrayType*>(aType);
+        auto* innerType = arrayType->GetInnerType();
+        const auto length = arrayType->GetLength(aValue);
+
+        for (uint32_t i = 0; i < length; ++i)
+        {
+            CollectStateObjects(innerType, arrayType->GetElement(aValue, i), aObjects);
+        }
+        break;
+    }
+    case Red::ERTTIType::Class:
+    {
+        auto* classType = reinterpret_cast<Red::CClass*>(aType);
+
+        Red::DynArray<Red::CProperty*> props;
+        classType->GetProperties(props);
+
+        for (const auto& prop : props)
+        {
+            CollectStateObjects(prop->type, prop->GetValuePtr<void>(aValue), aObjects);
+        }
+        break;
+    }
+    default: break;
+    }
+}
+
+// Objects reachable from more than one service would be duplicated by per-service chunks,
+// since each chunk is deserialized on its own and gets its own copy of every referenced object
+bool HasSharedStateObjects(const Core::Map<Red::CName, Red::Handle<App::ScriptableService>>& aServices)
+{
+    Core::Set<void*> visited;
+
+    for (const auto& [_, service] : aServices)
+    {
+        Core::Set<void*> objects;
+        CollectStateObjects(service.instance, objects);
+
+        for (const auto& object : objects)
+        {
+            if (!visited.insert(object).second)
+                return true;
+        }
+    }
+
+    return false;
+}
+}
+
 App::ScriptableServiceContainer::ScriptableServiceContainer(const std::filesystem::path& aStateDir)
     : m_stateFilePath((aStateDir / Red::GetTypeNameStr<ScriptableServiceContainer>().data()).replace_extension(".dat"))
 {
@@ -12,6 +104,9 @@ void App::ScriptableServiceContainer::OnInitializeScripts()
     Red::DynArray<Red::CClass*> serviceTypes;
     Red::CRTTISystem::Get()->GetClasses(Red::GetClass<ScriptableService>(), serviceTypes);
 
+    // Services usually register their callbacks on load, enable all requested hooks at once
+    Core::HookingTransaction hookingTransaction;
+
     for (auto serviceType : serviceTypes)
     {
         const auto& serviceIt = m_services.find(serviceType->name);
@@ -41,6 +136,8 @@ void App::ScriptableServiceContainer::OnInitializeScripts()
 
 void App::ScriptableServiceContainer::OnInitializeGameInstance()
 {
+    Core::HookingTransaction hookingTransaction;
+
     for (const auto& [serviceType, service] : m_services)
     {
         Red::CallVirtual(service, "OnInitialize");
@@ -78,50 +175,278 @@ void App::ScriptableServiceContainer::LoadState()
     if (!std::filesystem::exists(m_stateFilePath, error))
         return;
 
-    auto state = Red::MakeHandle<ScriptableServiceContainerState>();
+    Core::Map<Red::CName, StateChunk> chunks;
+    Core::Vector<Red::Handle<ScriptableService>> services;
 
     try
     {
-        Red::ObjectSerializer::ReadFromFile(state, m_stateFilePath);
+        Core::Vector<char> data;
+
+        {
+            std::ifstream in(m_stateFilePath, std::ios::binary | std::ios::ate);
+
+            if (!in.is_open())
+                throw std::runtime_error("can't open file");
+
+            const auto size = static_cast<std::streamoff>(in.tellg());
+
+            if (size < 0)
+                throw std::runtime_error("can't read file size");
+
+            data.resize(static_cast<size_t>(size));
+            in.seekg(0);
+            in.read(data.data(), static_cast<std::streamsize>(data.size()));
+
+            if (!in.good())
+                throw std::runtime_error("can't read file");
+        }
+
+        if (ReadStateChunks(data, chunks))
+        {
+            for (const auto& [serviceName, chunk] : chunks)
+            {
+                auto state = Red::MakeHandle<ScriptableServiceContainerState>();
+                Red::ObjectSerializer::ReadFromMemory(state, chunk.data.data(), chunk.header.size,
+                                                      chunk.header.alignment);
+
+                if (state)
+                {
+                    for (auto& service : state->services)
+                    {
+                        services.push_back(std::move(service));
+                    }
+                }
+
+                m_stateHashes[serviceName] = chunk.header.hash;
+            }
+
+            m_stateShared = chunks.contains(SharedStateChunk);
+        }
+        else
+        {
+            // Previous versions stored all services as a single object
+            auto state = Red::MakeHandle<ScriptableServiceContainerState>();
+            Red::ObjectSerializer::ReadFromFile(state, m_stateFilePath);
+
+            if (state)
+            {
+                for (auto& service : state->services)
+                {
+                    services.push_back(std::move(service));
+                }
+            }
+        }
     }
     catch (std::exception& ex)
     {
+        services.clear();
+
         LogError(R"([ScriptableServiceContainer] Can't load state from "{}": {})",
                  m_stateFilePath.string(), ex.what());
     }
 
-    if (state)
+    for (auto& service : services)
     {
-        for (auto& service : state->services)
+        if (service)
         {
-            if (service)
-            {
-                m_services.emplace(service->GetType()->name, std::move(service));
-            }
+            m_services.emplace(service->GetType()->name, std::move(service));
         }
     }
 }
 
 void App::ScriptableServiceContainer::SaveState()
 {
-    auto state = Red::MakeHandle<ScriptableServiceContainerState>();
-
-    for (const auto& [_, service] : m_services)
-    {
-        state->services.PushBack(service);
-    }
+    std::unique_lock _(m_stateLock);
 
     try
     {
-        Red::ObjectSerializer::SaveToFile(state, m_stateFilePath);
+        Core::Vector<StateChunk> chunks;
+        uint64_t liveSize = sizeof(StateHeader);
+        uint64_t appendSize = 0;
+
+        // Services that reference each other are stored together in a single chunk
+        const auto sharedState = HasSharedStateObjects(m_services);
+
+        if (sharedState != m_stateShared)
+        {
+            m_stateCompactionPending = true;
+        }
+
+        Core::Vector<std::pair<Red::CName, Red::Handle<ScriptableServiceContainerState>>> states;
+
+        if (sharedState)
+        {
+            auto& state = states.emplace_back(SharedStateChunk, Red::MakeHandle<ScriptableServiceContainerState>());
+
+            for (const auto& [serviceName, service] : m_services)
+            {
+                state.second->services.PushBack(service);
+            }
+        }
+        else
+        {
+            for (const auto& [serviceName, service] : m_services)
+            {
+                auto& state = states.emplace_back(serviceName, Red::MakeHandle<ScriptableServiceContainerState>());
+                state.second->services.PushBack(service);
+            }
+        }
+
+        chunks.reserve(states.size());
+
+        for (const auto& [serviceName, state] : states)
+        {
+            Red::DataBuffer buffer;
+            Red::ObjectSerializer::WriteToBuffer(state, buffer);
+
+            const auto* data = reinterpret_cast<const char*>(buffer.buffer.data);
+
+            auto& chunk = chunks.emplace_back();
+            chunk.header.service = serviceName.hash;
+            chunk.header.hash = Red::FNV1a64(reinterpret_cast<const uint8_t*>(data), buffer.buffer.size);
+            chunk.header.size = buffer.buffer.size;
+            chunk.header.alignment = buffer.buffer.alignment;
+            chunk.data.assign(data, data + buffer.buffer.size);
+
+            const auto chunkSize = sizeof(StateChunkHeader) + chunk.header.size;
+            const auto& hashIt = m_stateHashes.find(serviceName);
+
+            if (hashIt == m_stateHashes.end() || hashIt.value() != chunk.header.hash)
+            {
+                appendSize += chunkSize;
+            }
+
+            liveSize += chunkSize;
+        }
+
+        if (appendSize == 0 && !m_stateCompactionPending)
+            return;
+
+        const auto compact = m_stateCompactionPending || m_stateFileSize + appendSize > 2 * liveSize;
+        const auto success = compact ? WriteStateChunks(chunks) : AppendStateChunks(chunks);
+
+        if (!success)
+        {
+            m_stateCompactionPending = true;
+
+            LogError(R"([ScriptableServiceContainer] Can't save state to "{}".)", m_stateFilePath.string());
+            return;
+        }
+
+        if (compact)
+        {
+            m_stateHashes.clear();
+        }
+
+        for (const auto& chunk : chunks)
+        {
+            m_stateHashes[Red::CName(chunk.header.service)] = chunk.header.hash;
+        }
+
+        m_stateShared = sharedState;
+        m_stateFileSize = compact ? liveSize : m_stateFileSize + appendSize;
+        m_stateCompactionPending = false;
     }
     catch (std::exception& ex)
     {
+        m_stateCompactionPending = true;
+
         LogError(R"([ScriptableServiceContainer] Can't save state to "{}": {})",
                  m_stateFilePath.string(), ex.what());
     }
 }
 
+bool App::ScriptableServiceContainer::ReadStateChunks(const Core::Vector<char>& aData,
+                                                      Core::Map<Red::CName, StateChunk>& aChunks)
+{
+    if (aData.size() < sizeof(StateHeader))
+        return false;
+
+    const auto* header = reinterpret_cast<const StateHeader*>(aData.data());
+
+    if (header->magic != StateMagic || header->version != StateVersion)
+        return false;
+
+    auto offset = sizeof(StateHeader);
+
+    while (aData.size() - offset >= sizeof(StateChunkHeader))
+    {
+        StateChunkHeader chunkHeader{};
+        std::memcpy(&chunkHeader, aData.data() + offset, sizeof(StateChunkHeader));
+
+        const auto* chunkData = aData.data() + offset + sizeof(StateChunkHeader);
+
+        // A chunk that was not completely written ends the valid part of the file
+        if (chunkHeader.size > aData.size() - offset - sizeof(StateChunkHeader) ||
+            chunkHeader.hash != Red::FNV1a64(reinterpret_cast<const uint8_t*>(chunkData), chunkHeader.size))
+            break;
+
+        auto& chunk = aChunks[Red::CName(chunkHeader.service)];
+        chunk.header = chunkHeader;
+        chunk.data.assign(chunkData, chunkData + chunkHeader.size);
+
+        offset += sizeof(StateChunkHeader) + chunkHeader.size;
+    }
+
+    m_stateFileSize = offset;
+    m_stateCompactionPending = offset != aData.size();
+
+    return true;
+}
+
+bool App::ScriptableServiceContainer::AppendStateChunks(const Core::Vector<StateChunk>& aChunks)
+{
+    std::ofstream out(m_stateFilePath, std::ios::binary | std::ios::app);
+
+    if (!out.is_open())
+        return false;
+
+    for (const auto& chunk : aChunks)
+    {
+        const auto& hashIt = m_stateHashes.find(Red::CName(chunk.header.service));
+
+        if (hashIt != m_stateHashes.end() && hashIt.value() == chunk.header.hash)
+            continue;
+
+        out.write(reinterpret_cast<const char*>(&chunk.header), sizeof(StateChunkHeader));
+        out.write(chunk.data.data(), static_cast<std::streamsize>(chunk.data.size()));
+    }
+
+    out.flush();
+
+    return out.good();
+}
+
+bool App::ScriptableServiceContainer::WriteStateChunks(const Core::Vector<StateChunk>& aChunks)
+{
+    auto tempPath = m_stateFilePath;
+    tempPath += L".tmp";
+
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+
+        if (!out.is_open())
+            return false;
+
+        StateHeader header{StateMagic, StateVersion};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(StateHeader));
+
+        for (const auto& chunk : aChunks)
+        {
+            out.write(reinterpret_cast<const char*>(&chunk.header), sizeof(StateChunkHeader));
+            out.write(chunk.data.data(), static_cast<std::streamsize>(chunk.data.size()));
+        }
+
+        if (!out.good())
+            return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, m_stateFilePath, error);
+
+    return !error;
+}
+
 Red::Handle<App::ScriptableService> App::ScriptableServiceContainer::GetService(Red::CName aType)
 {
     auto it = m_services.find(aType);
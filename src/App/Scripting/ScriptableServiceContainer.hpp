@@ -32,13 +32,49 @@ private:
     uint32_t OnBeforeGameSave(const Red::JobGroup& aJobGroup, void* a2) override;
     void OnUninitialize() override;
 
+    // The state file is a header followed by a sequence of chunks, one service per chunk.
+    // Changed services are appended as new chunks that supersede the previous ones,
+    // the file is compacted through a temporary file when superseded chunks pile up.
+    // When services share objects, all services are stored in a single unnamed chunk instead.
+    static constexpr uint32_t StateMagic = 0x43535353; // SSSC
+    static constexpr uint32_t StateVersion = 1;
+
+    struct StateHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+    };
+
+    struct StateChunkHeader
+    {
+        uint64_t service;
+        uint64_t hash;
+        uint32_t size;
+        uint32_t alignment;
+    };
+
+    struct StateChunk
+    {
+        StateChunkHeader header;
+        Core::Vector<char> data;
+    };
+
     void LoadState();
     void SaveState();
+    bool ReadStateChunks(const Core::Vector<char>& aData, Core::Map<Red::CName, StateChunk>& aChunks);
+    bool AppendStateChunks(const Core::Vector<StateChunk>& aChunks);
+    bool WriteStateChunks(const Core::Vector<StateChunk>& aChunks);
 
     Core::Map<Red::CName, Red::Handle<ScriptableService>> m_services;
     std::filesystem::path m_stateFilePath;
     bool m_scriptsLoaded{false};
 
+    std::mutex m_stateLock;
+    Core::Map<Red::CName, uint64_t> m_stateHashes;
+    uint64_t m_stateFileSize{0};
+    bool m_stateCompactionPending{true};
+    bool m_stateShared{false};
+
     inline static Red::Handle<ScriptableServiceContainer> s_self;
 
     RTTI_IMPL_TYPEINFO(App::ScriptableServiceContainer);
@@ -1,6 +1,8 @@
 #include "ScriptingService.hpp"
 #include "App/Depot/CurveData.hpp"
 #include "App/Depot/ResourceReference.hpp"
+#include "App/Localization/LocalizationService.hpp"
+#include "App/Reflection/ReflectionIndex.hpp"
 
 namespace
 {
@@ -25,6 +27,8 @@ constexpr auto gameuiBaseUIDataTypeName = Red::CName("gameuiBaseUIData");
 constexpr auto scnChatterTypeName = Red::CName("scnChatter");
 constexpr auto audioEventElementTypeName = Red::CName("audioAudioEventMetadataArrayElement");
 constexpr auto entLODDefinitionTypeName = Red::CName("entLODDefinition");
+
+constexpr auto ConstructorFunctionName = Red::CName("OnConstruct");
 }
 
 App::ScriptingService::ScriptingService(const std::filesystem::path& aStateDir)
@@ -55,6 +59,16 @@ void App::ScriptingService::OnBootstrap()
 
 void App::ScriptingService::OnInitializeScripts()
 {
+    Red::InvalidateFunctionCache();
+    Red::InvalidateClassHierarchy();
+    ReflectionIndex::Invalidate();
+    LocalizationService::InvalidateOverlays();
+
+    {
+        std::unique_lock _(s_constructorsLock);
+        s_constructors.clear();
+    }
+
     if (Red::GetGlobalFunction("InitializeScripts;"))
     {
         if (!Red::CGameEngine::Get()->scriptsLoaded)
@@ -215,7 +229,7 @@ void App::ScriptingService::ScriptOpCodeCast(Red::IScriptable*, Red::CStackFrame
         if (aLhs)
         {
             auto rhs = rhsWeak.Lock();
-            if (rhs && !rhs->GetType()->IsA(lhsType))
+            if (rhs && !Red::IsA(rhs->GetType(), lhsType))
             {
                 rhs.Reset();
             }
@@ -230,7 +244,7 @@ void App::ScriptingService::ScriptOpCodeCast(Red::IScriptable*, Red::CStackFrame
 
         if (aLhs)
         {
-            if (rhs && !rhs->GetType()->IsA(lhsType))
+            if (rhs && !Red::IsA(rhs->GetType(), lhsType))
             {
                 rhs.Reset();
             }
@@ -244,10 +258,42 @@ void App::ScriptingService::OnCreateInstance(Red::IScriptable*& aInstance, Red::
 {
     if (aInstance && aClass->flags.isScriptedClass)
     {
-        Red::CallVirtual(aInstance, aClass, "OnConstruct");
+        if (auto constructor = GetConstructor(aClass))
+        {
+            // The constructor has no parameters, so the call frame is just the end of parameters
+            char code[] = {Red::Detail::ParamEndOp};
+            Red::CStackFrame frame(nullptr, code);
+            frame.func = constructor;
+
+            Red::Detail::CallFunctionWithFrame(constructor, aInstance, &frame, nullptr, nullptr);
+        }
     }
 }
 
+Red::CBaseFunction* App::ScriptingService::GetConstructor(Red::CClass* aClass)
+{
+    {
+        std::shared_lock _(s_constructorsLock);
+        auto constructorIt = s_constructors.find(aClass);
+        if (constructorIt != s_constructors.end())
+            return constructorIt.value();
+    }
+
+    auto constructor = Red::GetMemberFunction(aClass, ConstructorFunctionName);
+
+    if (constructor && (constructor->params.size > 0 || constructor->returnType))
+    {
+        constructor = nullptr;
+    }
+
+    {
+        std::unique_lock _(s_constructorsLock);
+        s_constructors.insert_or_assign(aClass, constructor);
+    }
+
+    return constructor;
+}
+
 void App::ScriptingService::GetScriptGameInstance(Red::IScriptable*, Red::CStackFrame* aFrame,
                                                   Red::ScriptGameInstance* aRet, Red::CBaseRTTIType*)
 {
@@ -24,6 +24,7 @@ protected:
     static void OnInitializeScripts();
     static void OnInitializeGameInstance();
     static void OnCreateInstance(Red::IScriptable*& aInstance, Red::CClass* aClass, uint32_t, bool);
+    static Red::CBaseFunction* GetConstructor(Red::CClass* aClass);
     static void OnValidateScripts(void* aValidator, Red::ScriptBundle* aBundle, void* aReport);
     static bool OnValidateScriptType(Red::CBaseRTTIType* aNativeType, Red::ScriptType* aScriptType);
     static void OnValidateTypeName(bool& aValid, Red::CName aScriptTypeName, Red::CName aNativeTypeName);
@@ -34,5 +35,7 @@ protected:
                                       Red::ScriptGameInstance* aRet, Red::CBaseRTTIType*);
 
     inline static std::filesystem::path s_stateDir;
+    inline static std::shared_mutex s_constructorsLock;
+    inline static Core::Map<Red::CClass*, Red::CBaseFunction*> s_constructors;
 };
 }
@@ -0,0 +1,153 @@
+#include "ResourcePathIndex.hpp"
+
+bool App::ResourcePathIndex::Load(const std::filesystem::path& aPath)
+{
+    m_file.reset(CreateFileW(aPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr));
+    if (!m_file)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(m_file.get(), &fileSize) || fileSize.QuadPart < sizeof(Header))
+        return false;
+
+    m_mapping.reset(CreateFileMappingW(m_file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+    if (!m_mapping)
+        return false;
+
+    m_view.reset(MapViewOfFile(m_mapping.get(), FILE_MAP_READ, 0, 0, 0));
+    if (!m_view)
+        return false;
+
+    const auto* data = reinterpret_cast<const char*>(m_view.get());
+    const auto* header = reinterpret_cast<const Header*>(data);
+
+    if (header->magic != Magic || header->version != Version)
+        return false;
+
+    const auto expectedSize = sizeof(Header) + header->count * sizeof(uint64_t) +
+                              (header->count + 1) * sizeof(uint32_t) + header->blobSize;
+
+    if (static_cast<uint64_t>(fileSize.QuadPart) != expectedSize)
+        return false;
+
+    m_hashes = reinterpret_cast<const uint64_t*>(data + sizeof(Header));
+    m_offsets = reinterpret_cast<const uint32_t*>(m_hashes + header->count);
+    m_blob = reinterpret_cast<const char*>(m_offsets + header->count + 1);
+    m_count = header->count;
+
+    return true;
+}
+
+int64_t App::ResourcePathIndex::FindIndex(uint64_t aHash) const
+{
+    const auto* end = m_hashes + m_count;
+    const auto* it = std::lower_bound(m_hashes, end, aHash);
+
+    if (it == end || *it != aHash)
+        return -1;
+
+    return it - m_hashes;
+}
+
+std::string_view App::ResourcePathIndex::Find(uint64_t aHash) const
+{
+    const auto index = FindIndex(aHash);
+
+    if (index < 0)
+        return {};
+
+    return {m_blob + m_offsets[index], m_offsets[index + 1] - m_offsets[index]};
+}
+
+bool App::ResourcePathIndex::Contains(uint64_t aHash) const
+{
+    return FindIndex(aHash) >= 0;
+}
+
+size_t App::ResourcePathIndex::GetSize() const
+{
+    return m_count;
+}
+
+bool App::ResourcePathIndex::Convert(const std::filesystem::path& aTextPath, const std::filesystem::path& aBinaryPath)
+{
+    std::ifstream in(aTextPath);
+
+    if (!in.is_open())
+        return false;
+
+    Core::Vector<std::string> paths;
+    Core::Vector<std::pair<uint64_t, uint32_t>> entries;
+
+    {
+        std::string s;
+        while (std::getline(in, s))
+        {
+            entries.emplace_back(Red::ResourcePath::HashSanitized(s.data()), static_cast<uint32_t>(paths.size()));
+            paths.emplace_back(std::move(s));
+        }
+    }
+
+    std::ranges::sort(entries);
+
+    const auto duplicates = std::ranges::unique(entries, {}, &std::pair<uint64_t, uint32_t>::first);
+    entries.erase(duplicates.begin(), duplicates.end());
+
+    Header header{Magic, Version, static_cast<uint32_t>(entries.size()), 0};
+    Core::Vector<uint64_t> hashes;
+    Core::Vector<uint32_t> offsets;
+
+    hashes.reserve(entries.size());
+    offsets.reserve(entries.size() + 1);
+
+    for (const auto& [hash, pathIndex] : entries)
+    {
+        hashes.push_back(hash);
+        offsets.push_back(header.blobSize);
+        header.blobSize += static_cast<uint32_t>(paths[pathIndex].size());
+    }
+
+    offsets.push_back(header.blobSize);
+
+    auto tempPath = aBinaryPath;
+    tempPath += L".tmp";
+
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+
+        if (!out.is_open())
+            return false;
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(hashes.data()), hashes.size() * sizeof(uint64_t));
+        out.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(uint32_t));
+
+        for (const auto& [hash, pathIndex] : entries)
+        {
+            out.write(paths[pathIndex].data(), paths[pathIndex].size());
+        }
+
+        if (!out.good())
+            return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, aBinaryPath, error);
+
+    return !error;
+}
+
+bool App::ResourcePathIndex::IsUpToDate(const std::filesystem::path& aTextPath,
+                                        const std::filesystem::path& aBinaryPath)
+{
+    std::error_code error;
+
+    if (!std::filesystem::exists(aBinaryPath, error))
+        return false;
+
+    if (!std::filesystem::exists(aTextPath, error))
+        return true;
+
+    return std::filesystem::last_write_time(aBinaryPath, error) >= std::filesystem::last_write_time(aTextPath, error);
+}
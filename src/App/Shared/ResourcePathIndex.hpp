@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Core/Win.hpp"
+
+namespace App
+{
+// Read-only table of known resource paths memory mapped from a prebuilt file.
+// The file consists of a header, an array of sorted path hashes,
+// an array of string offsets parallel to the hashes and a single string blob.
+class ResourcePathIndex
+{
+public:
+    ResourcePathIndex() = default;
+    ~ResourcePathIndex() = default;
+
+    ResourcePathIndex(const ResourcePathIndex&) = delete;
+    ResourcePathIndex& operator=(const ResourcePathIndex&) = delete;
+
+    bool Load(const std::filesystem::path& aPath);
+
+    [[nodiscard]] std::string_view Find(uint64_t aHash) const;
+    [[nodiscard]] bool Contains(uint64_t aHash) const;
+    [[nodiscard]] size_t GetSize() const;
+
+    static bool Convert(const std::filesystem::path& aTextPath, const std::filesystem::path& aBinaryPath);
+    static bool IsUpToDate(const std::filesystem::path& aTextPath, const std::filesystem::path& aBinaryPath);
+
+private:
+    static constexpr uint32_t Magic = 0x58485052; // RPHX
+    static constexpr uint32_t Version = 1;
+
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t count;
+        uint32_t blobSize;
+    };
+
+    [[nodiscard]] int64_t FindIndex(uint64_t aHash) const;
+
+    wil::unique_hfile m_file;
+    wil::unique_handle m_mapping;
+    wil::unique_mapview_ptr<void> m_view;
+    const uint64_t* m_hashes{nullptr};
+    const uint32_t* m_offsets{nullptr};
+    const char* m_blob{nullptr};
+    uint32_t m_count{0};
+};
+}
@@ -0,0 +1,198 @@
+#include "ResourcePathPattern.hpp"
+
+namespace
+{
+constexpr auto RegexPrefix = std::string_view("regex:");
+constexpr auto Wildcard = '*';
+
+inline uint64_t HashPrefix(std::string_view aPrefix)
+{
+    return Red::FNV1a64(reinterpret_cast<const uint8_t*>(aPrefix.data()), aPrefix.size());
+}
+}
+
+App::ResourcePathPattern::ResourcePathPattern(std::string_view aPattern)
+{
+    if (aPattern.starts_with(RegexPrefix))
+    {
+        aPattern.remove_prefix(RegexPrefix.size());
+
+        m_type = PatternType::Regex;
+        m_regex = std::regex(aPattern.data(), aPattern.size());
+        return;
+    }
+
+    auto wildcardPos = aPattern.find(Wildcard);
+
+    if (wildcardPos == std::string_view::npos)
+        return;
+
+    m_type = PatternType::Wildcard;
+    m_prefix = aPattern.substr(0, wildcardPos);
+    aPattern.remove_prefix(wildcardPos + 1);
+
+    if (!m_prefix.empty())
+    {
+        m_prefixID = RegisterPrefix(m_prefix);
+    }
+
+    wildcardPos = aPattern.rfind(Wildcard);
+
+    if (wildcardPos == std::string_view::npos)
+    {
+        m_suffix = aPattern;
+    }
+    else
+    {
+        m_suffix = aPattern.substr(wildcardPos + 1);
+        aPattern.remove_suffix(aPattern.size() - wildcardPos);
+
+        while (!aPattern.empty())
+        {
+            wildcardPos = aPattern.find(Wildcard);
+
+            const auto infix = aPattern.substr(0, wildcardPos);
+            if (!infix.empty())
+            {
+                m_infixes.emplace_back(infix);
+                m_minLength += infix.size();
+            }
+
+            if (wildcardPos == std::string_view::npos)
+                break;
+
+            aPattern.remove_prefix(wildcardPos + 1);
+        }
+    }
+
+    m_minLength += m_prefix.size() + m_suffix.size();
+}
+
+bool App::ResourcePathPattern::IsDefined() const
+{
+    return m_type != PatternType::None;
+}
+
+bool App::ResourcePathPattern::Matches(std::string_view aPath) const
+{
+    switch (m_type)
+    {
+    case PatternType::Wildcard:
+    {
+        if (aPath.size() < m_minLength || !aPath.starts_with(m_prefix))
+            return false;
+
+        return MatchesRemainder(aPath);
+    }
+    case PatternType::Regex:
+    {
+        return std::regex_match(aPath.begin(), aPath.end(), m_regex.value());
+    }
+    default:
+        return false;
+    }
+}
+
+bool App::ResourcePathPattern::Matches(std::string_view aPath, const PrefixMatch& aPrefixMatch) const
+{
+    if (m_type != PatternType::Wildcard || m_prefixID >= aPrefixMatch.prefixCount)
+        return Matches(aPath);
+
+    if (aPath.size() < m_minLength)
+        return false;
+
+    if (std::find(aPrefixMatch.prefixIDs.begin(), aPrefixMatch.prefixIDs.end(), m_prefixID) ==
+        aPrefixMatch.prefixIDs.end())
+        return false;
+
+    return MatchesRemainder(aPath);
+}
+
+bool App::ResourcePathPattern::MatchesRemainder(std::string_view aPath) const
+{
+    if (!aPath.ends_with(m_suffix))
+        return false;
+
+    aPath.remove_prefix(m_prefix.size());
+    aPath.remove_suffix(m_suffix.size());
+
+    // With a single kind of wildcard, taking the leftmost occurrence
+    // of every infix is enough to find a match if there is one
+    for (const auto& infix : m_infixes)
+    {
+        const auto infixPos = aPath.find(infix);
+
+        if (infixPos == std::string_view::npos)
+            return false;
+
+        aPath.remove_prefix(infixPos + infix.size());
+    }
+
+    return true;
+}
+
+void App::ResourcePathPattern::MatchPrefixes(std::string_view aPath, PrefixMatch& aPrefixMatch)
+{
+    auto& index = GetPrefixIndex();
+    std::shared_lock _(index.lock);
+
+    aPrefixMatch.prefixCount = index.count;
+    aPrefixMatch.prefixIDs.clear();
+
+    // Lengths are sorted, so the scan stops at the first prefix longer than the path,
+    // and at most one prefix of each length can match
+    for (const auto length : index.lengths)
+    {
+        if (length > aPath.size())
+            break;
+
+        const auto prefix = aPath.substr(0, length);
+        const auto it = index.ids.find(HashPrefix(prefix));
+
+        if (it != index.ids.end() && index.prefixes[it.value()] == prefix)
+        {
+            aPrefixMatch.prefixIDs.push_back(it.value());
+        }
+    }
+}
+
+uint32_t App::ResourcePathPattern::GetPrefixCount()
+{
+    return GetPrefixIndex().count;
+}
+
+uint32_t App::ResourcePathPattern::RegisterPrefix(std::string_view aPrefix)
+{
+    auto& index = GetPrefixIndex();
+    std::unique_lock _(index.lock);
+
+    const auto hash = HashPrefix(aPrefix);
+    const auto it = index.ids.find(hash);
+
+    if (it != index.ids.end())
+    {
+        // A colliding prefix is left out of the index and compared directly
+        return index.prefixes[it.value()] == aPrefix ? it.value() : NoPrefixID;
+    }
+
+    const auto id = static_cast<uint32_t>(index.prefixes.size());
+
+    index.ids.emplace(hash, id);
+    index.prefixes.emplace_back(aPrefix);
+
+    const auto lengthIt = std::lower_bound(index.lengths.begin(), index.lengths.end(), aPrefix.size());
+    if (lengthIt == index.lengths.end() || *lengthIt != aPrefix.size())
+    {
+        index.lengths.insert(lengthIt, aPrefix.size());
+    }
+
+    index.count = id + 1;
+
+    return id;
+}
+
+App::ResourcePathPattern::PrefixIndex& App::ResourcePathPattern::GetPrefixIndex()
+{
+    static PrefixIndex s_index;
+    return s_index;
+}
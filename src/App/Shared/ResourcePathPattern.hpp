@@ -0,0 +1,61 @@
+#pragma once
+
+namespace App
+{
+class ResourcePathPattern
+{
+public:
+    // Prefixes of all wildcard patterns matching a single path.
+    // Collected once per path and shared by every pattern tested against it.
+    struct PrefixMatch
+    {
+        uint32_t prefixCount{0};
+        Core::Vector<uint32_t> prefixIDs;
+    };
+
+    ResourcePathPattern() = default;
+    explicit ResourcePathPattern(std::string_view aPattern);
+
+    [[nodiscard]] bool IsDefined() const;
+    [[nodiscard]] bool Matches(std::string_view aPath) const;
+    [[nodiscard]] bool Matches(std::string_view aPath, const PrefixMatch& aPrefixMatch) const;
+
+    static void MatchPrefixes(std::string_view aPath, PrefixMatch& aPrefixMatch);
+    [[nodiscard]] static uint32_t GetPrefixCount();
+
+private:
+    enum class PatternType : uint8_t
+    {
+        None,
+        Wildcard,
+        Regex,
+    };
+
+    // Prefixes are shared by all patterns and never removed. Lookups go through
+    // the distinct prefix lengths, so a path is tested against every prefix
+    // with one hash per length instead of one comparison per pattern.
+    struct PrefixIndex
+    {
+        std::shared_mutex lock;
+        Core::Map<uint64_t, uint32_t> ids;
+        Core::Vector<std::string> prefixes;
+        Core::Vector<size_t> lengths;
+        std::atomic<uint32_t> count{0};
+    };
+
+    static constexpr uint32_t NoPrefixID = std::numeric_limits<uint32_t>::max();
+
+    [[nodiscard]] bool MatchesRemainder(std::string_view aPath) const;
+
+    static uint32_t RegisterPrefix(std::string_view aPrefix);
+    static PrefixIndex& GetPrefixIndex();
+
+    PatternType m_type{PatternType::None};
+    std::string m_prefix;
+    std::string m_suffix;
+    Core::Vector<std::string> m_infixes;
+    size_t m_minLength{0};
+    uint32_t m_prefixID{NoPrefixID};
+    std::optional<std::regex> m_regex;
+};
+}
@@ -4,7 +4,7 @@
 
 namespace
 {
-constexpr auto SharedName = Red::CName("ResourcePathRegistryV3" BUILD_SUFFIX);
+constexpr auto SharedName = Red::CName("ResourcePathRegistryV5" BUILD_SUFFIX);
 }
 
 App::ResourcePathRegistry::ResourcePathRegistry(const std::filesystem::path& aPreloadPath)
@@ -20,7 +20,6 @@ void App::ResourcePathRegistry::OnBootstrap()
     if (!s_instance->m_initialized)
     {
         s_instance->m_initialized = true;
-        s_instance->m_map.reserve(400000);
 
         HookAfter<Raw::ResourcePath::Create>(&OnCreatePath);
     }
@@ -28,43 +27,94 @@ void App::ResourcePathRegistry::OnBootstrap()
     if (!s_instance->m_preloaded && !s_preloadPath.empty() && std::filesystem::exists(s_preloadPath))
     {
         s_instance->m_preloaded = true;
+        s_instance->m_preloading = true;
 
         std::thread([lock = std::move(lock)]() {
             LogInfo("[ResourcePathRegistry] Loading metadata...");
 
-            std::ifstream f(s_preloadPath);
-            std::string s;
-            while (std::getline(f, s))
+            if (!LoadBaseLayer())
             {
-                s_instance->m_map[Red::ResourcePath::HashSanitized(s.data())] = std::move(s);
+                LoadTextLayer();
             }
 
-            LogInfo("[ResourcePathRegistry] Loaded {} predefined hashes.", s_instance->m_map.size());
+            s_instance->m_preloading = false;
         }).detach();
     }
 }
 
+bool App::ResourcePathRegistry::LoadBaseLayer()
+{
+    auto binaryPath = s_preloadPath;
+    binaryPath.replace_extension(L".bin");
+
+    if (!ResourcePathIndex::IsUpToDate(s_preloadPath, binaryPath))
+    {
+        if (!ResourcePathIndex::Convert(s_preloadPath, binaryPath))
+        {
+            LogWarning("[ResourcePathRegistry] Can't convert metadata to binary format.");
+            return false;
+        }
+    }
+
+    if (!s_instance->m_base.Load(binaryPath))
+    {
+        LogWarning("[ResourcePathRegistry] Can't map binary metadata.");
+        return false;
+    }
+
+    s_instance->m_baseLoaded = true;
+
+    LogInfo("[ResourcePathRegistry] Mapped {} predefined hashes.", s_instance->m_base.GetSize());
+
+    return true;
+}
+
+void App::ResourcePathRegistry::LoadTextLayer()
+{
+    std::ifstream f(s_preloadPath);
+    std::string s;
+    while (std::getline(f, s))
+    {
+        s_instance->m_paths.Insert(Red::ResourcePath::HashSanitized(s.data()), s);
+    }
+
+    LogInfo("[ResourcePathRegistry] Loaded {} predefined hashes.", s_instance->m_paths.GetSize());
+}
+
 void App::ResourcePathRegistry::OnCreatePath(Red::ResourcePath* aPath, Red::StringView* aPathStr)
 {
-    if (aPathStr)
+    if (aPathStr && *aPath && FindPath(aPath->hash).empty())
     {
-        std::scoped_lock _(s_instance->m_lock);
-        s_instance->m_map[*aPath] = {aPathStr->data, aPathStr->size};
+        s_instance->m_paths.Insert(aPath->hash, {aPathStr->data, aPathStr->size});
     }
 }
 
-std::string App::ResourcePathRegistry::ResolvePath(Red::ResourcePath aPath)
+std::string_view App::ResourcePathRegistry::FindPath(uint64_t aHash)
+{
+    if (const auto str = s_instance->m_paths.Find(aHash); !str.empty())
+        return str;
+
+    if (s_instance->m_baseLoaded)
+        return s_instance->m_base.Find(aHash);
+
+    return {};
+}
+
+std::string_view App::ResourcePathRegistry::ResolvePath(Red::ResourcePath aPath)
 {
     if (!aPath)
         return {};
 
-    std::shared_lock _(s_instance->m_lock);
-    const auto& it = s_instance->m_map.find(aPath);
+    auto str = FindPath(aPath.hash);
 
-    if (it == s_instance->m_map.end())
-        return {};
+    if (str.empty() && s_instance->m_preloading)
+    {
+        // Wait for the preloading thread to release the lock
+        std::shared_lock _(s_instance->m_lock);
+        str = FindPath(aPath.hash);
+    }
 
-    return it.value();
+    return str;
 }
 
 std::string App::ResourcePathRegistry::ResolvePathOrHash(Red::ResourcePath aPath)
@@ -73,37 +123,50 @@ std::string App::ResourcePathRegistry::ResolvePathOrHash(Red::ResourcePath aPath
 
     if (str.empty())
     {
-        str = std::to_string(aPath.hash);
+        return std::to_string(aPath.hash);
     }
 
-    return str;
+    return std::string(str);
+}
+
+bool App::ResourcePathRegistry::MatchPath(Red::ResourcePath aPath, const ResourcePathPattern& aPattern)
+{
+    // Targets of the same event test the same path one after another,
+    // so the resolved string and its matching prefixes are reused until the path changes
+    thread_local Red::ResourcePath t_lastPath;
+    thread_local std::string_view t_lastStr;
+    thread_local ResourcePathPattern::PrefixMatch t_lastPrefixes;
+
+    if (aPath != t_lastPath || t_lastPrefixes.prefixCount != ResourcePathPattern::GetPrefixCount())
+    {
+        t_lastStr = ResolvePath(aPath);
+        t_lastPath = t_lastStr.empty() ? Red::ResourcePath{} : aPath;
+
+        ResourcePathPattern::MatchPrefixes(t_lastStr, t_lastPrefixes);
+    }
+
+    if (t_lastStr.empty())
+        return false;
+
+    return aPattern.Matches(t_lastStr, t_lastPrefixes);
 }
 
-Red::ResourcePath App::ResourcePathRegistry::RegisterPath(const std::string& aPathStr)
+Red::ResourcePath App::ResourcePathRegistry::RegisterPath(std::string_view aPathStr)
 {
     if (aPathStr.empty())
         return {};
 
-    auto path = Red::ResourcePath(aPathStr.data());
+    auto path = Red::ResourcePath(std::string(aPathStr).data());
 
     RegisterPath(path, aPathStr);
 
     return path;
 }
 
-void App::ResourcePathRegistry::RegisterPath(Red::ResourcePath aPath, const std::string& aPathStr)
+void App::ResourcePathRegistry::RegisterPath(Red::ResourcePath aPath, std::string_view aPathStr)
 {
-    if (!aPath)
+    if (!aPath || !FindPath(aPath.hash).empty())
         return;
 
-    {
-        std::shared_lock _(s_instance->m_lock);
-        if (s_instance->m_map.contains(aPath))
-            return;
-    }
-
-    {
-        std::scoped_lock _(s_instance->m_lock);
-        s_instance->m_map[aPath] = aPathStr;
-    }
+    s_instance->m_paths.Insert(aPath.hash, aPathStr);
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "App/Shared/ResourcePathIndex.hpp"
+#include "App/Shared/ResourcePathPattern.hpp"
+#include "App/Shared/ResourcePathTable.hpp"
 #include "Core/Foundation/Feature.hpp"
 #include "Core/Hooking/HookingAgent.hpp"
 #include "Core/Logging/LoggingAgent.hpp"
@@ -15,17 +18,21 @@ class ResourcePathRegistry
 public:
     ResourcePathRegistry(const std::filesystem::path& aPreloadPath = {});
 
-    [[nodiscard]] std::string ResolvePath(Red::ResourcePath aPath);
+    [[nodiscard]] std::string_view ResolvePath(Red::ResourcePath aPath);
     [[nodiscard]] std::string ResolvePathOrHash(Red::ResourcePath aPath);
+    [[nodiscard]] bool MatchPath(Red::ResourcePath aPath, const ResourcePathPattern& aPattern);
 
-    Red::ResourcePath RegisterPath(const std::string& aPathStr);
-    void RegisterPath(Red::ResourcePath aPath, const std::string& aPathStr);
+    Red::ResourcePath RegisterPath(std::string_view aPathStr);
+    void RegisterPath(Red::ResourcePath aPath, std::string_view aPathStr);
 
 protected:
     struct SharedInstance
     {
         Red::SharedSpinLock m_lock;
-        Core::Map<Red::ResourcePath, std::string> m_map;
+        ResourcePathTable m_paths;
+        ResourcePathIndex m_base;
+        std::atomic<bool> m_baseLoaded{false};
+        std::atomic<bool> m_preloading{false};
         bool m_preloaded{false};
         bool m_initialized{false};
     };
@@ -33,6 +40,11 @@ protected:
     void OnBootstrap() override;
     static void OnCreatePath(Red::ResourcePath* aPath, Red::StringView* aPathStr);
 
+    static bool LoadBaseLayer();
+    static void LoadTextLayer();
+
+    static std::string_view FindPath(uint64_t aHash);
+
     inline static SharedInstance* s_instance;
     inline static std::filesystem::path s_preloadPath;
 };
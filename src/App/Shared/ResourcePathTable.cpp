@@ -0,0 +1,142 @@
+#include "ResourcePathTable.hpp"
+
+App::ResourcePathTable::PathTable::PathTable(uint32_t aCapacity)
+    : mask(aCapacity - 1)
+    , slots(std::make_unique<std::atomic<const PathEntry*>[]>(aCapacity))
+{
+}
+
+App::ResourcePathTable::ResourcePathTable()
+{
+    for (auto& shard : m_shards)
+    {
+        auto& table = shard.tables.emplace_back(std::make_unique<PathTable>(InitialShardCapacity));
+        shard.table = table.get();
+    }
+}
+
+std::string_view App::ResourcePathTable::Find(uint64_t aHash) const
+{
+    const auto* table = GetShard(aHash).table.load(std::memory_order_acquire);
+
+    for (auto slot = GetSlot(aHash, table->mask);; slot = (slot + 1) & table->mask)
+    {
+        const auto* entry = table->slots[slot].load(std::memory_order_acquire);
+
+        if (!entry)
+            return {};
+
+        if (entry->hash == aHash)
+            return {entry->data, entry->length};
+    }
+}
+
+void App::ResourcePathTable::Insert(uint64_t aHash, std::string_view aPathStr)
+{
+    auto& shard = GetShard(aHash);
+    std::scoped_lock _(shard.lock);
+
+    auto* table = shard.table.load(std::memory_order_relaxed);
+
+    for (auto slot = GetSlot(aHash, table->mask);; slot = (slot + 1) & table->mask)
+    {
+        const auto* entry = table->slots[slot].load(std::memory_order_relaxed);
+
+        if (!entry)
+            break;
+
+        if (entry->hash == aHash)
+            return;
+    }
+
+    InsertSlot(table, AllocateEntry(shard, aHash, aPathStr));
+    ++shard.size;
+
+    if (shard.size * 2 > table->mask + 1)
+    {
+        auto& grownTable = shard.tables.emplace_back(std::make_unique<PathTable>((table->mask + 1) * 2));
+
+        for (uint32_t slot = 0; slot <= table->mask; ++slot)
+        {
+            if (const auto* entry = table->slots[slot].load(std::memory_order_relaxed))
+            {
+                InsertSlot(grownTable.get(), entry);
+            }
+        }
+
+        shard.table.store(grownTable.get(), std::memory_order_release);
+    }
+}
+
+void App::ResourcePathTable::InsertSlot(PathTable* aTable, const PathEntry* aEntry)
+{
+    auto slot = GetSlot(aEntry->hash, aTable->mask);
+
+    while (aTable->slots[slot].load(std::memory_order_relaxed))
+    {
+        slot = (slot + 1) & aTable->mask;
+    }
+
+    aTable->slots[slot].store(aEntry, std::memory_order_release);
+}
+
+const App::ResourcePathTable::PathEntry* App::ResourcePathTable::AllocateEntry(PathShard& aShard, uint64_t aHash,
+                                                                               std::string_view aPathStr)
+{
+    constexpr auto Alignment = alignof(PathEntry);
+
+    const auto entrySize = (offsetof(PathEntry, data) + aPathStr.size() + 1 + Alignment - 1) & ~(Alignment - 1);
+
+    if (entrySize > aShard.arenaLeft)
+    {
+        const auto blockSize = std::max(entrySize, ArenaBlockSize);
+
+        aShard.arenaHead = aShard.arena.emplace_back(std::make_unique<char[]>(blockSize)).get();
+        aShard.arenaLeft = blockSize;
+        aShard.arenaSize += blockSize;
+    }
+
+    auto* entry = reinterpret_cast<PathEntry*>(aShard.arenaHead);
+    entry->hash = aHash;
+    entry->length = static_cast<uint32_t>(aPathStr.size());
+    std::memcpy(entry->data, aPathStr.data(), aPathStr.size());
+    entry->data[aPathStr.size()] = '\0';
+
+    aShard.arenaHead += entrySize;
+    aShard.arenaLeft -= entrySize;
+
+    return entry;
+}
+
+size_t App::ResourcePathTable::GetSize()
+{
+    size_t size = 0;
+
+    for (auto& shard : m_shards)
+    {
+        std::scoped_lock _(shard.lock);
+        size += shard.size;
+    }
+
+    return size;
+}
+
+size_t App::ResourcePathTable::GetMemoryUsage()
+{
+    size_t usage = sizeof(ResourcePathTable);
+
+    for (auto& shard : m_shards)
+    {
+        std::scoped_lock _(shard.lock);
+
+        // Replaced tables count too, they are only released with the table
+        for (const auto& table : shard.tables)
+        {
+            usage += sizeof(PathTable) + (table->mask + 1) * sizeof(std::atomic<const PathEntry*>);
+        }
+
+        usage += shard.arenaSize;
+    }
+
+    return usage;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+namespace App
+{
+// Concurrent table of resource paths by hash. Paths are split into shards by the top bits
+// of their hash, each shard is an open addressing table of pointers into a string arena.
+// Lookups never lock, inserts lock only the owning shard.
+class ResourcePathTable
+{
+public:
+    ResourcePathTable();
+
+    ResourcePathTable(const ResourcePathTable&) = delete;
+    ResourcePathTable& operator=(const ResourcePathTable&) = delete;
+
+    [[nodiscard]] std::string_view Find(uint64_t aHash) const;
+    void Insert(uint64_t aHash, std::string_view aPathStr);
+
+    [[nodiscard]] size_t GetSize();
+    [[nodiscard]] size_t GetMemoryUsage();
+
+private:
+    static constexpr uint32_t ShardBits = 6;
+    static constexpr uint32_t ShardCount = 1 << ShardBits;
+    static constexpr uint32_t InitialShardCapacity = 1 << 10;
+    static constexpr size_t ArenaBlockSize = 64 * 1024;
+
+    struct PathEntry
+    {
+        uint64_t hash;
+        uint32_t length;
+        char data[1];
+    };
+
+    // Open addressing table with linear probing. Readers never take locks,
+    // so tables are never modified in place except for filling empty slots,
+    // and replaced tables are kept alive for the lifetime of the table.
+    struct PathTable
+    {
+        explicit PathTable(uint32_t aCapacity);
+
+        uint32_t mask;
+        std::unique_ptr<std::atomic<const PathEntry*>[]> slots;
+    };
+
+    struct PathShard
+    {
+        Red::SharedSpinLock lock;
+        std::atomic<PathTable*> table;
+        uint32_t size{0};
+        Core::Vector<std::unique_ptr<PathTable>> tables;
+        Core::Vector<std::unique_ptr<char[]>> arena;
+        char* arenaHead{nullptr};
+        size_t arenaLeft{0};
+        size_t arenaSize{0};
+    };
+
+    static void InsertSlot(PathTable* aTable, const PathEntry* aEntry);
+    static const PathEntry* AllocateEntry(PathShard& aShard, uint64_t aHash, std::string_view aPathStr);
+
+    inline PathShard& GetShard(uint64_t aHash)
+    {
+        return m_shards[aHash >> (64 - ShardBits)];
+    }
+
+    inline const PathShard& GetShard(uint64_t aHash) const
+    {
+        return m_shards[aHash >> (64 - ShardBits)];
+    }
+
+    inline static uint32_t GetSlot(uint64_t aHash, uint32_t aMask)
+    {
+        return static_cast<uint32_t>(aHash ^ (aHash >> 32)) & aMask;
+    }
+
+    std::array<PathShard, ShardCount> m_shards;
+};
+}
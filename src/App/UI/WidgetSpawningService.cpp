@@ -5,6 +5,8 @@
 namespace
 {
 constexpr auto ControllerSeparator = ':';
+constexpr auto MaxLinkedLibraries = 1024;
+constexpr auto DependencyLoadingTimeout = std::chrono::milliseconds(1000);
 
 Red::ClassLocator<Red::ink::IWidgetController> s_gameControllerType;
 Red::ClassLocator<Red::ink::WidgetLogicController> s_logicControllerType;
@@ -26,6 +28,10 @@ void App::WidgetSpawningService::OnShutdown()
     Unhook<Raw::InkWidgetLibrary::AsyncSpawnFromLocal>();
     Unhook<Raw::InkWidgetLibrary::AsyncSpawnFromExternal>();
     Unhook<Raw::InkSpawner::FinishAsyncSpawn>();
+
+    std::unique_lock _(s_mutex);
+    s_linkedLibraries.clear();
+    s_prefetchedLibraries.clear();
 }
 
 uintptr_t App::WidgetSpawningService::OnSpawnLocal(Red::ink::WidgetLibraryResource& aLibrary,
@@ -65,7 +71,7 @@ uintptr_t App::WidgetSpawningService::OnSpawnExternal(Red::ink::WidgetLibraryRes
                                                       Red::ResourcePath aExternalPath,
                                                       Red::CName aItemName)
 {
-    InjectDependency(aLibrary, aExternalPath);
+    InjectDependency(aLibrary, aExternalPath, true);
 
     return Raw::InkWidgetLibrary::SpawnFromExternal(aLibrary, aInstance, aExternalPath, aItemName);
 }
@@ -90,7 +96,8 @@ bool App::WidgetSpawningService::OnAsyncSpawnExternal(Red::ink::WidgetLibraryRes
                                                       Red::ResourcePath aExternalPath,
                                                       Red::CName aItemName)
 {
-    InjectDependency(aLibrary, aExternalPath);
+    // The async spawner resolves the library token on its own, so there is no need to wait here
+    InjectDependency(aLibrary, aExternalPath, false);
 
     return Raw::InkWidgetLibrary::AsyncSpawnFromExternal(aLibrary, aSpawningInfo, aExternalPath, aItemName);
 }
@@ -120,34 +127,128 @@ void App::WidgetSpawningService::OnFinishAsyncSpawn(Red::InkSpawningContext& aCo
     }
 }
 
-void App::WidgetSpawningService::InjectDependency(Red::ink::WidgetLibraryResource& aLibrary, Red::ResourcePath aExternalPath)
+void App::WidgetSpawningService::InjectDependency(Red::ink::WidgetLibraryResource& aLibrary,
+                                                  Red::ResourcePath aExternalPath, bool aWaitForLoading)
 {
-    bool libraryExists = false;
+    ExternalLibraryToken token;
 
-    // Check if the external library is in the list and do nothing if it is
+    // Check if the external library is in the list and only wait for it if it is,
+    // an async spawn could have linked it without waiting for the loading
     {
         std::shared_lock _(s_mutex);
-        for (const auto& externalLibrary : aLibrary.externalLibraries)
+        const auto& linkedIt = s_linkedLibraries.find(&aLibrary);
+
+        if (linkedIt != s_linkedLibraries.end() && IsLinked(linkedIt.value(), aLibrary, aExternalPath))
         {
-            if (externalLibrary.path == aExternalPath)
+            if (aWaitForLoading)
             {
-                libraryExists = true;
-                break;
+                const auto& tokenIt = linkedIt.value().tokens.find(aExternalPath.hash);
+
+                if (tokenIt != linkedIt.value().tokens.end())
+                {
+                    token = tokenIt.value();
+                }
             }
+
+            if (!token)
+                return;
         }
     }
 
+    if (token)
+    {
+        WaitForDependency(token);
+        return;
+    }
+
     // Add the requested library to the list
-    if (!libraryExists)
     {
         std::unique_lock _(s_mutex);
-        aLibrary.externalLibraries.EmplaceBack(aExternalPath);
 
-        // Load requested library for the spawner
-        auto* externalLibrary = aLibrary.externalLibraries.End() - 1;
-        externalLibrary->LoadAsync();
+        if (s_linkedLibraries.size() >= MaxLinkedLibraries && !s_linkedLibraries.contains(&aLibrary))
+        {
+            s_linkedLibraries.clear();
+        }
+
+        auto& linked = s_linkedLibraries[&aLibrary];
 
-        Red::WaitForResource(externalLibrary->token, std::chrono::milliseconds(1000));
+        // Rebuild the index if the library was modified outside or the address is reused by another library
+        if (linked.libraryPath != aLibrary.path || linked.count != aLibrary.externalLibraries.size)
+        {
+            if (linked.libraryPath != aLibrary.path)
+            {
+                linked.tokens.clear();
+            }
+
+            linked.libraryPath = aLibrary.path;
+            linked.count = aLibrary.externalLibraries.size;
+            linked.paths.clear();
+
+            for (const auto& externalLibrary : aLibrary.externalLibraries)
+            {
+                linked.paths.insert(externalLibrary.path.hash);
+            }
+        }
+
+        if (linked.paths.contains(aExternalPath.hash))
+        {
+            const auto& tokenIt = linked.tokens.find(aExternalPath.hash);
+
+            if (tokenIt != linked.tokens.end())
+            {
+                token = tokenIt.value();
+            }
+        }
+        else
+        {
+            aLibrary.externalLibraries.EmplaceBack(aExternalPath);
+
+            // Load requested library for the spawner, this is instant if the library was prefetched
+            auto* externalLibrary = aLibrary.externalLibraries.End() - 1;
+            externalLibrary->LoadAsync();
+
+            linked.paths.insert(aExternalPath.hash);
+            linked.tokens[aExternalPath.hash] = externalLibrary->token;
+            linked.count = aLibrary.externalLibraries.size;
+
+            token = externalLibrary->token;
+        }
+    }
+
+    if (aWaitForLoading && token)
+    {
+        WaitForDependency(token);
+    }
+}
+
+void App::WidgetSpawningService::WaitForDependency(const ExternalLibraryToken& aToken)
+{
+    if (!aToken->IsLoaded() && !aToken->IsFailed())
+    {
+        Red::WaitForResource(aToken, DependencyLoadingTimeout);
+    }
+}
+
+bool App::WidgetSpawningService::IsLinked(const LinkedLibraries& aLinked, Red::ink::WidgetLibraryResource& aLibrary,
+                                          Red::ResourcePath aExternalPath)
+{
+    return aLinked.libraryPath == aLibrary.path && aLinked.count == aLibrary.externalLibraries.size &&
+           aLinked.paths.contains(aExternalPath.hash);
+}
+
+void App::WidgetSpawningService::PrefetchLibraries(
+    const Red::DynArray<Red::RaRef<Red::inkWidgetLibraryResource>>& aPaths)
+{
+    auto loader = Red::ResourceLoader::Get();
+
+    std::unique_lock _(s_mutex);
+
+    for (const auto& path : aPaths)
+    {
+        if (!s_prefetchedLibraries.contains(path.path.hash))
+        {
+            s_prefetchedLibraries.emplace(path.path.hash, loader->LoadAsync(path.path));
+        }
     }
 }
 
@@ -16,6 +16,7 @@ public:
     static constexpr auto WidgetSpawnEventName = "InkWidget/Spawn";
 
     static void ToggleWidgetSpawnEvent(bool aState);
+    static void PrefetchLibraries(const Red::DynArray<Red::RaRef<Red::inkWidgetLibraryResource>>& aPaths);
 
 protected:
     void OnBootstrap() override;
@@ -38,13 +39,29 @@ protected:
     static void OnFinishAsyncSpawn(Red::InkSpawningContext& aContext,
                                    Red::Handle<Red::ink::WidgetLibraryItemInstance>& aInstance);
 
+    using ExternalLibraryToken =
+        decltype(std::declval<Red::ink::WidgetLibraryResource&>().externalLibraries.Begin()->token);
+
+    struct LinkedLibraries
+    {
+        Red::ResourcePath libraryPath;
+        uint32_t count;
+        Core::Set<uint64_t> paths;
+        Core::Map<uint64_t, ExternalLibraryToken> tokens;
+    };
+
     inline static void InjectDependency(Red::ink::WidgetLibraryResource& aLibrary,
-                                        Red::ResourcePath aExternalPath);
+                                        Red::ResourcePath aExternalPath, bool aWaitForLoading);
+    inline static bool IsLinked(const LinkedLibraries& aLinked, Red::ink::WidgetLibraryResource& aLibrary,
+                                Red::ResourcePath aExternalPath);
+    inline static void WaitForDependency(const ExternalLibraryToken& aToken);
     inline static void InjectController(Red::Handle<Red::ink::WidgetLibraryItemInstance>& aInstance,
                                         Red::CName aControllerName);
     inline static void InheritProperties(Red::IScriptable* aTarget, Red::IScriptable* aSource);
 
     inline static std::shared_mutex s_mutex;
+    inline static Core::Map<Red::ink::WidgetLibraryResource*, LinkedLibraries> s_linkedLibraries;
+    inline static Core::Map<uint64_t, Red::SharedPtr<Red::ResourceToken<>>> s_prefetchedLibraries;
     inline static bool s_widgetSpawnEventEnabled{false};
 };
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "App/UI/WidgetSpawningService.hpp"
+
 namespace App
 {
 struct inkWidgetLibraryEx : Red::inkWidgetLibraryResourceWrapper
@@ -8,9 +10,15 @@ struct inkWidgetLibraryEx : Red::inkWidgetLibraryResourceWrapper
     {
         library = aPath;
     }
+
+    static void Prefetch(const Red::DynArray<Red::RaRef<Red::inkWidgetLibraryResource>>& aPaths)
+    {
+        WidgetSpawningService::PrefetchLibraries(aPaths);
+    }
 };
 }
 
 RTTI_EXPAND_CLASS(Red::inkWidgetLibraryResourceWrapper, App::inkWidgetLibraryEx, {
     RTTI_METHOD(SetPath);
+    RTTI_METHOD(Prefetch);
 });
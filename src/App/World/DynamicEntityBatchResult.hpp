@@ -0,0 +1,20 @@
+#pragma once
+
+namespace App
+{
+struct DynamicEntityBatchResult : Red::IScriptable
+{
+    DynamicEntityBatchResult() = default;
+
+    Red::DynArray<Red::EntityID> entityIDs;
+    Red::DynArray<bool> results;
+
+    RTTI_IMPL_TYPEINFO(App::DynamicEntityBatchResult);
+    RTTI_IMPL_ALLOCATOR();
+};
+}
+
+RTTI_DEFINE_CLASS(App::DynamicEntityBatchResult, {
+    RTTI_GETTER(entityIDs);
+    RTTI_GETTER(results);
+});
@@ -17,6 +17,7 @@ struct DynamicEntitySpec : Red::IScriptable
         , spawnInView(true)
         , tags()
         , active(true)
+        , streamingDistance()
     {
     }
 
@@ -33,6 +34,7 @@ struct DynamicEntitySpec : Red::IScriptable
         , spawnInView(aOther.spawnInView)
         , tags(aOther.tags)
         , active(aOther.active)
+        , streamingDistance(aOther.streamingDistance)
     {
     }
 
@@ -48,6 +50,11 @@ struct DynamicEntitySpec : Red::IScriptable
         return !IsRecord() && !templatePath.path.IsEmpty();
     }
 
+    [[nodiscard]] inline bool IsStreamed() const
+    {
+        return streamingDistance > 0;
+    }
+
     void PrepareForSaving()
     {
         templateHash = templatePath.path;
@@ -70,6 +77,7 @@ struct DynamicEntitySpec : Red::IScriptable
     bool spawnInView;
     Red::DynArray<Red::CName> tags;
     bool active;
+    float streamingDistance;
 
     RTTI_IMPL_TYPEINFO(App::DynamicEntitySpec);
     RTTI_IMPL_ALLOCATOR();
@@ -91,4 +99,5 @@ RTTI_DEFINE_CLASS(App::DynamicEntitySpec, {
     RTTI_PERSISTENT(spawnInView);
     RTTI_PERSISTENT(tags);
     RTTI_PERSISTENT(active);
+    RTTI_PERSISTENT(streamingDistance);
 });
@@ -6,12 +6,17 @@ namespace App
 {
 struct DynamicEntityState : Red::IScriptable
 {
-    DynamicEntityState() = default;
+    DynamicEntityState()
+        : entityStub(nullptr)
+        , streamedIn(false)
+    {
+    }
 
     DynamicEntityState(Red::EntityID aEntityId, const DynamicEntitySpec& aEntitySpec)
         : entityID(aEntityId)
         , entitySpec(Red::MakeHandle<DynamicEntitySpec>(aEntitySpec))
         , entityStub(nullptr)
+        , streamedIn(false)
     {
     }
 
@@ -28,6 +33,7 @@ struct DynamicEntityState : Red::IScriptable
     Red::EntityID entityID;
     Red::Handle<DynamicEntitySpec> entitySpec;
     Red::EntityStub* entityStub;
+    bool streamedIn;
 
     RTTI_IMPL_TYPEINFO(App::DynamicEntityState);
     RTTI_IMPL_ALLOCATOR();
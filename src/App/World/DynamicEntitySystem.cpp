@@ -1,4 +1,5 @@
 #include "DynamicEntitySystem.hpp"
+#include "Red/Entity.hpp"
 #include "Red/RuntimeScene.hpp"
 #include "Red/TagSystem.hpp"
 #include "Red/TweakDB.hpp"
@@ -6,6 +7,39 @@
 namespace
 {
 constexpr auto SystemPersistentID = Red::PersistentID(Red::GetTypeName<App::DynamicEntitySystem>());
+
+constexpr uint32_t StreamingSpawnBudget = 4;
+constexpr float StreamingDespawnFactor = 1.25f;
+constexpr float StreamingRescanDistance = 4.0f;
+
+bool GetEntityPosition(const Red::Handle<Red::Entity>& aEntity, Red::Vector4& aPosition)
+{
+    if (!aEntity)
+        return false;
+
+    auto* transform = Raw::Entity::TransformComponent::Ptr(aEntity);
+
+    if (!transform)
+        return false;
+
+    const auto& position = transform->worldTransform.Position;
+
+    aPosition.X = static_cast<float>(position.x.Bits) / 131072.0f;
+    aPosition.Y = static_cast<float>(position.y.Bits) / 131072.0f;
+    aPosition.Z = static_cast<float>(position.z.Bits) / 131072.0f;
+    aPosition.W = 0.0f;
+
+    return true;
+}
+
+float GetDistanceSq(const Red::Vector4& aA, const Red::Vector4& aB)
+{
+    const auto dx = aA.X - aB.X;
+    const auto dy = aA.Y - aB.Y;
+    const auto dz = aA.Z - aB.Z;
+
+    return dx * dx + dy * dy + dz * dz;
+}
 }
 
 void App::DynamicEntitySystem::OnWorldAttached(Red::world::RuntimeScene*)
@@ -17,6 +51,9 @@ void App::DynamicEntitySystem::OnWorldAttached(Red::world::RuntimeScene*)
     m_entityRegistry = Red::GetRuntimeSystem<Red::worldRuntimeEntityRegistry>();
     m_populationSystem = Red::GetGameSystem<Red::IPopulationSystem>();
     m_spawnEventBroadcaster = Red::GetGameSystem<Red::IEntitySpawnerEventsBroadcaster>();
+    m_playerSystem = Red::GetGameSystem<Red::gameIPlayerSystem>();
+    m_playerCallSite = Red::CallSite(
+        Red::GetMemberFunction(Red::GetClass<Red::gameIPlayerSystem>(), "GetLocalPlayerMainGameObject"));
     m_persistentStateType = Red::GetClass<DynamicEntitySystemPS>();
     m_ready = true;
 }
@@ -32,15 +69,21 @@ void App::DynamicEntitySystem::OnStreamingWorldLoaded(Red::world::RuntimeScene*,
     m_persistencySystem->GetPersistentState(m_persistentState, SystemPersistentID, m_persistentStateType, true);
     m_persistentState->RestoreAfterLoading();
 
-    for (const auto& entityState : m_persistentState->GetEntityStates())
     {
-        if (!entityState->entitySpec->persistState)
+        Red::TweakDBBatch recordBatch;
+
+        for (const auto& entityState : m_persistentState->GetEntityStates())
         {
-            RemovePersistentState(entityState);
-            UpdateTransientID(entityState);
+            if (!entityState->entitySpec->persistState)
+            {
+                RemovePersistentState(entityState);
+                UpdateTransientID(entityState);
+            }
+
+            RestoreEntityState(entityState, recordBatch);
         }
 
-        RestoreEntityState(entityState);
+        recordBatch.Commit();
     }
 
     m_persistentState->Clear();
@@ -50,12 +93,17 @@ void App::DynamicEntitySystem::OnStreamingWorldLoaded(Red::world::RuntimeScene*,
         std::shared_lock _(m_entityStateLock);
         for (const auto& entityState : m_entityStates)
         {
-            if (entityState->entitySpec->persistSpawn && entityState->entitySpec->active)
+            // Streamed entities are spawned by the streaming update once the player is in range,
+            // with or without persistSpawn, since spawning them out of range would only despawn them again
+            if (entityState->entitySpec->persistSpawn && entityState->entitySpec->active &&
+                !entityState->entitySpec->IsStreamed())
             {
                 RespawnFromEntityState(entityState);
             }
         }
     }
+
+    m_streamingDirty = true;
 }
 
 uint32_t App::DynamicEntitySystem::OnBeforeGameSave(const Red::JobGroup& aJobGroup, void* a2)
@@ -95,11 +143,19 @@ void App::DynamicEntitySystem::OnAfterWorldDetach()
     m_restored = false;
     m_persistentState.Reset();
 
+    m_streamingQueue.clear();
+    m_streamingDirty = false;
+
     {
         std::unique_lock _(m_entityStateLock);
         m_entityStates.clear();
         m_entityStateByID.clear();
         m_entityStatesByTag.clear();
+        m_entityPositions.Clear();
+        m_streamedPositions.Clear();
+        m_streamedInIDs.clear();
+        m_streamedCount = 0;
+        m_maxStreamingDistance = 0;
     }
 
     {
@@ -125,10 +181,160 @@ void App::DynamicEntitySystem::OnEntitySpawnerEvent(Red::game::EntitySpawnerEven
             }
         }
     }
+    else if (aType == Red::game::EntitySpawnerEventType::Despawn)
+    {
+        UpdateEntityPosition(aEntityID);
+    }
 
     ProcessListeners(aEntityID, aType);
 }
 
+void App::DynamicEntitySystem::OnRegisterUpdates(Red::UpdateRegistrar* aRegistrar)
+{
+    aRegistrar->RegisterUpdate(Red::UpdateTickGroup::FrameBegin, this, "DynamicEntitySystem/Tick",
+                               {this, &DynamicEntitySystem::OnUpdateTick});
+}
+
+void App::DynamicEntitySystem::OnUpdateTick(Red::FrameInfo& aFrame, Red::JobQueue& aJobQueue)
+{
+    if (!m_ready || !m_persistentState)
+        return;
+
+    if (m_streamedCount == 0 && m_streamingQueue.empty())
+        return;
+
+    Red::Vector4 playerPosition{};
+
+    if (!GetPlayerPosition(playerPosition))
+        return;
+
+    if (m_streamingDirty || GetDistanceSq(playerPosition, m_streamingOrigin) >
+                                StreamingRescanDistance * StreamingRescanDistance)
+    {
+        UpdateStreamingQueue(playerPosition);
+    }
+
+    for (uint32_t budget = StreamingSpawnBudget; budget > 0 && !m_streamingQueue.empty(); --budget)
+    {
+        auto entityState = std::move(m_streamingQueue.back());
+        m_streamingQueue.pop_back();
+
+        StreamInEntityState(entityState);
+    }
+}
+
+void App::DynamicEntitySystem::UpdateStreamingQueue(const Red::Vector4& aOrigin)
+{
+    Core::Vector<std::pair<float, DynamicEntityStatePtr>> streamIn;
+    Core::Vector<DynamicEntityStatePtr> streamOut;
+
+    {
+        std::shared_lock _(m_entityStateLock);
+
+        // Only streamed entities within the largest streaming distance can be streamed in
+        m_streamedPositions.ForEachInRadius(aOrigin, m_maxStreamingDistance, [&](Red::EntityID aEntityID) {
+            const auto& entityState = m_entityStateByID.find(aEntityID).value();
+            const auto& entitySpec = entityState->entitySpec;
+
+            if (entityState->streamedIn || !entitySpec->active)
+                return;
+
+            Red::Vector4 position{};
+            m_streamedPositions.GetPosition(aEntityID, position);
+
+            const auto distanceSq = GetDistanceSq(aOrigin, position);
+
+            if (distanceSq <= entitySpec->streamingDistance * entitySpec->streamingDistance)
+            {
+                streamIn.emplace_back(distanceSq, entityState);
+            }
+        });
+
+        for (const auto& entityID : m_streamedInIDs)
+        {
+            const auto& entityState = m_entityStateByID.find(entityID).value();
+            const auto& entitySpec = entityState->entitySpec;
+
+            if (!entitySpec->active)
+                continue;
+
+            const auto despawnDistance = entitySpec->streamingDistance * StreamingDespawnFactor;
+
+            Red::Vector4 position{};
+            m_streamedPositions.GetPosition(entityID, position);
+
+            if (GetDistanceSq(aOrigin, position) > despawnDistance * despawnDistance)
+            {
+                streamOut.push_back(entityState);
+            }
+        }
+    }
+
+    // The queue is consumed from the back, so the nearest entities go last
+    std::ranges::sort(streamIn, std::ranges::greater{}, &std::pair<float, DynamicEntityStatePtr>::first);
+
+    m_streamingQueue.clear();
+    m_streamingQueue.reserve(streamIn.size());
+
+    for (auto& [distanceSq, entityState] : streamIn)
+    {
+        m_streamingQueue.push_back(std::move(entityState));
+    }
+
+    for (const auto& entityState : streamOut)
+    {
+        StreamOutEntityState(entityState);
+    }
+
+    m_streamingOrigin = aOrigin;
+    m_streamingDirty = false;
+}
+
+void App::DynamicEntitySystem::StreamInEntityState(const DynamicEntityStatePtr& aEntityState)
+{
+    {
+        std::unique_lock _(m_entityStateLock);
+
+        if (aEntityState->streamedIn || !aEntityState->entitySpec->active ||
+            !m_entityStateByID.contains(aEntityState->entityID))
+            return;
+
+        aEntityState->streamedIn = true;
+        m_streamedInIDs.insert(aEntityState->entityID);
+    }
+
+    if (!RespawnFromEntityState(aEntityState))
+    {
+        SpawnFromEntityState(aEntityState);
+    }
+}
+
+void App::DynamicEntitySystem::StreamOutEntityState(const DynamicEntityStatePtr& aEntityState)
+{
+    {
+        std::unique_lock _(m_entityStateLock);
+
+        if (!aEntityState->streamedIn)
+            return;
+
+        aEntityState->streamedIn = false;
+        m_streamedInIDs.erase(aEntityState->entityID);
+    }
+
+    DespawnFromEntityState(aEntityState);
+    ResetEntityStub(aEntityState);
+}
+
+bool App::DynamicEntitySystem::GetPlayerPosition(Red::Vector4& aPosition)
+{
+    Red::Handle<Red::Entity> player;
+
+    if (!m_playerSystem || !m_playerCallSite(m_playerSystem, player))
+        return false;
+
+    return GetEntityPosition(player, aPosition);
+}
+
 bool App::DynamicEntitySystem::IsReady() const
 {
     return m_ready;
@@ -147,28 +353,105 @@ Red::EntityID App::DynamicEntitySystem::CreateEntity(const DynamicEntitySpecPtr&
     if (!ValidateEntitySpec(aEntitySpec))
         return {};
 
-    Red::EntityID entityID{};
+    auto entityID = GenerateEntityID(aEntitySpec);
 
-    if (aEntitySpec->persistState)
+    if (!entityID.IsDefined())
+        return {};
+
+    auto entityState = CreateEntityState(entityID, aEntitySpec);
+
+    if (aEntitySpec->IsStreamed())
     {
-        m_entityIDSystem->GetNextPersistableID(entityID);
+        m_streamingDirty = true;
     }
-    else
+    else if (aEntitySpec->active)
     {
-        m_entityIDSystem->GetNextTransientID(entityID);
+        SpawnFromEntityState(entityState);
     }
 
-    if (!entityID.IsDefined())
+    return entityID;
+}
+
+Red::DynArray<Red::EntityID> App::DynamicEntitySystem::CreateEntities(
+    const Red::DynArray<DynamicEntitySpecPtr>& aEntitySpecs, const Red::Handle<Red::IScriptable>& aTarget,
+    Red::CName aFunction)
+{
+    if (!m_ready)
         return {};
 
-    auto entityState = CreateEntityState(entityID, aEntitySpec);
+    auto entityBatch = Core::MakeShared<EntityBatch>();
+    entityBatch->entityStates.resize(aEntitySpecs.size);
+    entityBatch->result = Red::MakeHandle<DynamicEntityBatchResult>();
+    entityBatch->result->entityIDs.Reserve(aEntitySpecs.size);
+    entityBatch->result->results.Reserve(aEntitySpecs.size);
+    entityBatch->target = aTarget;
+    entityBatch->function = aFunction;
+
+    Core::Vector<DynamicEntityStatePtr> entityStates;
+    entityStates.reserve(aEntitySpecs.size);
 
-    if (aEntitySpec->active)
+    Red::TweakDBBatch recordBatch;
+
+    for (uint32_t i = 0; i < aEntitySpecs.size; ++i)
     {
-        SpawnFromEntityState(entityState);
+        const auto& entitySpec = aEntitySpecs[i];
+
+        Red::EntityID entityID{};
+
+        if (entitySpec && ValidateEntitySpec(entitySpec))
+        {
+            entityID = GenerateEntityID(entitySpec);
+        }
+
+        entityBatch->result->entityIDs.PushBack(entityID);
+        entityBatch->result->results.PushBack(entityID.IsDefined());
+
+        if (!entityID.IsDefined())
+            continue;
+
+        auto entityState = Red::MakeHandle<DynamicEntityState>(entityID, *entitySpec);
+
+        if (entityState->entitySpec->IsTemplate())
+        {
+            entityState->entitySpec->recordID = ConvertTemplateToRecord(entityState->entitySpec->templatePath,
+                                                                        recordBatch);
+        }
+
+        entityBatch->entityStates[i] = entityState;
+        entityStates.push_back(std::move(entityState));
     }
 
-    return entityID;
+    recordBatch.Commit();
+
+    AddEntityStates(entityStates);
+
+    const auto entityIDs = entityBatch->result->entityIDs;
+
+    // Keep one extra pending count until all requests are issued,
+    // so the batch can't complete while it's still being populated
+    entityBatch->pending = 1;
+
+    for (uint32_t i = 0; i < entityBatch->entityStates.size(); ++i)
+    {
+        const auto& entityState = entityBatch->entityStates[i];
+
+        if (!entityState)
+            continue;
+
+        if (entityState->entitySpec->IsStreamed())
+        {
+            m_streamingDirty = true;
+        }
+        else if (entityState->entitySpec->active)
+        {
+            ++entityBatch->pending;
+            SpawnFromEntityBatch(entityBatch, i);
+        }
+    }
+
+    ReleaseEntityBatch(entityBatch);
+
+    return entityIDs;
 }
 
 bool App::DynamicEntitySystem::DeleteEntity(Red::EntityID aEntityID)
@@ -210,6 +493,12 @@ bool App::DynamicEntitySystem::EnableEntity(Red::EntityID aEntityID)
 
     entityState->entitySpec->active = true;
 
+    if (entityState->entitySpec->IsStreamed())
+    {
+        m_streamingDirty = true;
+        return true;
+    }
+
     return RespawnFromEntityState(entityState);
 }
 
@@ -231,6 +520,15 @@ bool App::DynamicEntitySystem::DisableEntity(Red::EntityID aEntityID)
 
     entityState->entitySpec->active = false;
 
+    if (entityState->entitySpec->IsStreamed())
+    {
+        if (!entityState->streamedIn)
+            return true;
+
+        entityState->streamedIn = false;
+        m_streamedInIDs.erase(entityState->entityID);
+    }
+
     return DespawnFromEntityState(entityState);
 }
 
@@ -249,13 +547,66 @@ bool App::DynamicEntitySystem::SpawnFromEntityState(const App::DynamicEntityStat
             return;
         }
 
+        if (!AcquireEntityStub(aEntityState, aToken))
+        {
+            DiscardEntityStub(aEntityState);
+            return;
+        }
+
         RegisterPopulation(aEntityState, false);
-        AcquireEntityStub(aEntityState, aToken);
     });
 
     return true;
 }
 
+void App::DynamicEntitySystem::SpawnFromEntityBatch(const EntityBatchPtr& aEntityBatch, uint32_t aIndex)
+{
+    const auto& entityState = aEntityBatch->entityStates[aIndex];
+
+    Red::EntityStubTokenPtr token{};
+    Red::EntityStubCreateRequest request{entityState->entityID,
+                                         entityState->entitySpec->position,
+                                         entityState->entitySpec->orientation,
+                                         entityState->entitySpec->recordID};
+
+    m_entityStubSystem->CreateStub(token, request, [this, aEntityBatch, aIndex](Red::EntityStubTokenPtr& aToken) {
+        const auto& entityState = aEntityBatch->entityStates[aIndex];
+
+        if (aToken->status != Red::EntityStubStatus::Created)
+        {
+            DeleteEntity(entityState->entityID);
+            aEntityBatch->result->results[aIndex] = false;
+            ReleaseEntityBatch(aEntityBatch);
+            return;
+        }
+
+        if (AcquireEntityStub(entityState, aToken))
+        {
+            RegisterPopulation(entityState, false);
+        }
+        else
+        {
+            DiscardEntityStub(entityState);
+        }
+
+        ReleaseEntityBatch(aEntityBatch);
+    });
+}
+
+void App::DynamicEntitySystem::ReleaseEntityBatch(const EntityBatchPtr& aEntityBatch)
+{
+    if (--aEntityBatch->pending != 0)
+        return;
+
+    if (!aEntityBatch->function)
+        return;
+
+    if (auto target = aEntityBatch->target.Lock())
+    {
+        Red::CallVirtual(target, aEntityBatch->function, aEntityBatch->result);
+    }
+}
+
 bool App::DynamicEntitySystem::RespawnFromEntityState(const App::DynamicEntityStatePtr& aEntityState)
 {
     if (aEntityState->entityStub)
@@ -284,8 +635,13 @@ bool App::DynamicEntitySystem::RespawnFromEntityState(const App::DynamicEntitySt
             return;
         }
 
+        if (!AcquireEntityStub(aEntityState, aToken))
+        {
+            DiscardEntityStub(aEntityState);
+            return;
+        }
+
         RegisterPopulation(aEntityState, true);
-        AcquireEntityStub(aEntityState, aToken);
     });
 
     return true;
@@ -339,11 +695,31 @@ void App::DynamicEntitySystem::RemovePersistentState(const App::DynamicEntitySta
     m_persistencySystem->RemoveDynamicEntityState(aEntityState->entityID);
 }
 
-void App::DynamicEntitySystem::AcquireEntityStub(const App::DynamicEntityStatePtr& aEntityState,
+bool App::DynamicEntitySystem::AcquireEntityStub(const App::DynamicEntityStatePtr& aEntityState,
                                                  Red::EntityStubTokenPtr& aToken)
 {
     std::unique_lock _(m_entityStateLock);
     aEntityState->AcquireStub(*aToken);
+
+    // Stubs are created asynchronously, in the meantime the entity could be deleted, disabled or streamed out,
+    // in which case there was no stub to despawn yet and the new one must not be populated
+    const auto& entitySpec = aEntityState->entitySpec;
+
+    return entitySpec->active && (!entitySpec->IsStreamed() || aEntityState->streamedIn) &&
+           m_entityStateByID.contains(aEntityState->entityID);
+}
+
+void App::DynamicEntitySystem::DiscardEntityStub(const App::DynamicEntityStatePtr& aEntityState)
+{
+    if (aEntityState->entitySpec->persistState && IsManaged(aEntityState->entityID))
+    {
+        ResetEntityStub(aEntityState);
+    }
+    else
+    {
+        RemoveEntityStub(aEntityState);
+        ResetEntityStub(aEntityState);
+    }
 }
 
 void App::DynamicEntitySystem::ResetEntityStub(const App::DynamicEntityStatePtr& aEntityState)
@@ -373,13 +749,14 @@ App::DynamicEntityStatePtr App::DynamicEntitySystem::CreateEntityState(Red::Enti
     return entityState;
 }
 
-void App::DynamicEntitySystem::RestoreEntityState(const App::DynamicEntityStatePtr& aEntityState)
+void App::DynamicEntitySystem::RestoreEntityState(const App::DynamicEntityStatePtr& aEntityState,
+                                                   Red::TweakDBBatch& aRecordBatch)
 {
     auto& entitySpec = aEntityState->entitySpec;
 
     if (entitySpec->templateHash && entitySpec->recordID.name.length <= 1)
     {
-        entitySpec->recordID = ConvertTemplateToRecord(entitySpec->templatePath);
+        entitySpec->recordID = ConvertTemplateToRecord(entitySpec->templatePath, aRecordBatch);
     }
 
     AddEntityState(aEntityState);
@@ -396,6 +773,59 @@ void App::DynamicEntitySystem::AddEntityState(const App::DynamicEntityStatePtr&
     {
         m_entityStatesByTag[tag].insert(aEntityState->entityID);
     }
+
+    m_entityPositions.Insert(aEntityState->entityID, aEntityState->entitySpec->position);
+
+    AddStreamedPosition(aEntityState);
+}
+
+void App::DynamicEntitySystem::AddEntityStates(const Core::Vector<DynamicEntityStatePtr>& aEntityStates)
+{
+    if (aEntityStates.empty())
+        return;
+
+    Core::Map<Red::CName, Core::Vector<Red::EntityID>> entityIDsByTag;
+
+    for (const auto& entityState : aEntityStates)
+    {
+        for (const auto& tag : entityState->entitySpec->tags)
+        {
+            entityIDsByTag[tag].push_back(entityState->entityID);
+        }
+    }
+
+    std::unique_lock _(m_entityStateLock);
+
+    m_entityStates.reserve(m_entityStates.size() + aEntityStates.size());
+    m_entityStateByID.reserve(m_entityStateByID.size() + aEntityStates.size());
+
+    for (const auto& entityState : aEntityStates)
+    {
+        m_entityStates.emplace_back(entityState);
+        m_entityStateByID.insert({entityState->entityID, entityState});
+        m_entityPositions.Insert(entityState->entityID, entityState->entitySpec->position);
+
+        AddStreamedPosition(entityState);
+    }
+
+    for (const auto& [tag, entityIDs] : entityIDsByTag)
+    {
+        auto& taggedIDs = m_entityStatesByTag[tag];
+        taggedIDs.reserve(taggedIDs.size() + entityIDs.size());
+        taggedIDs.insert(entityIDs.begin(), entityIDs.end());
+    }
+}
+
+void App::DynamicEntitySystem::AddStreamedPosition(const App::DynamicEntityStatePtr& aEntityState)
+{
+    const auto& entitySpec = aEntityState->entitySpec;
+
+    if (!entitySpec->IsStreamed())
+        return;
+
+    m_streamedPositions.Insert(aEntityState->entityID, entitySpec->position);
+    m_maxStreamingDistance = std::max(m_maxStreamingDistance, entitySpec->streamingDistance);
+    ++m_streamedCount;
 }
 
 void App::DynamicEntitySystem::UpdateTransientID(const App::DynamicEntityStatePtr& aEntityState)
@@ -403,6 +833,30 @@ void App::DynamicEntitySystem::UpdateTransientID(const App::DynamicEntityStatePt
     m_entityIDSystem->GetNextTransientID(aEntityState->entityID);
 }
 
+void App::DynamicEntitySystem::UpdateEntityPosition(Red::EntityID aEntityID)
+{
+    Red::Vector4 position{};
+
+    if (!GetEntityPosition(GetEntity(aEntityID), position))
+        return;
+
+    std::unique_lock _(m_entityStateLock);
+
+    auto entityStateIt = m_entityStateByID.find(aEntityID);
+
+    if (entityStateIt == m_entityStateByID.end())
+        return;
+
+    m_entityPositions.Insert(aEntityID, position);
+
+    // Persistent entities are restored where they were left, so they are streamed from there,
+    // other entities are always spawned at the position from the spec
+    if (entityStateIt.value()->entitySpec->persistState && m_streamedPositions.Contains(aEntityID))
+    {
+        m_streamedPositions.Insert(aEntityID, position);
+    }
+}
+
 App::DynamicEntityStatePtr App::DynamicEntitySystem::RemoveEntityState(Red::EntityID aEntityID)
 {
     std::unique_lock _(m_entityStateLock);
@@ -419,8 +873,15 @@ App::DynamicEntityStatePtr App::DynamicEntitySystem::RemoveEntityState(Red::Enti
     }
 
     m_entityStateByID.erase(entityState->entityID);
+    m_entityPositions.Remove(entityState->entityID);
     std::erase(m_entityStates, entityState);
 
+    if (m_streamedPositions.Remove(entityState->entityID))
+    {
+        m_streamedInIDs.erase(entityState->entityID);
+        --m_streamedCount;
+    }
+
     return entityState;
 }
 
@@ -673,15 +1134,109 @@ void App::DynamicEntitySystem::DisableTagged(Red::CName aTag)
     }
 }
 
+Red::DynArray<Red::EntityID> App::DynamicEntitySystem::GetInRadius(const Red::Vector4& aCenter, float aRadius,
+                                                                  Red::CName aTag)
+{
+    if (!m_ready)
+        return {};
+
+    std::shared_lock _(m_entityStateLock);
+    Red::DynArray<Red::EntityID> out;
+
+    if (aTag)
+    {
+        const auto taggedIt = m_entityStatesByTag.find(aTag);
+
+        if (taggedIt == m_entityStatesByTag.end())
+            return {};
+
+        const auto& tagged = taggedIt.value();
+
+        m_entityPositions.ForEachInRadius(aCenter, aRadius, [&](Red::EntityID aEntityID) {
+            if (tagged.contains(aEntityID))
+            {
+                out.PushBack(aEntityID);
+            }
+        });
+    }
+    else
+    {
+        m_entityPositions.ForEachInRadius(aCenter, aRadius, [&](Red::EntityID aEntityID) {
+            out.PushBack(aEntityID);
+        });
+    }
+
+    return out;
+}
+
+Red::DynArray<Red::EntityID> App::DynamicEntitySystem::GetInBox(const Red::Vector4& aMin, const Red::Vector4& aMax,
+                                                               Red::CName aTag)
+{
+    if (!m_ready)
+        return {};
+
+    std::shared_lock _(m_entityStateLock);
+    Red::DynArray<Red::EntityID> out;
+
+    if (aTag)
+    {
+        const auto taggedIt = m_entityStatesByTag.find(aTag);
+
+        if (taggedIt == m_entityStatesByTag.end())
+            return {};
+
+        const auto& tagged = taggedIt.value();
+
+        m_entityPositions.ForEachInBox(aMin, aMax, [&](Red::EntityID aEntityID) {
+            if (tagged.contains(aEntityID))
+            {
+                out.PushBack(aEntityID);
+            }
+        });
+    }
+    else
+    {
+        m_entityPositions.ForEachInBox(aMin, aMax, [&](Red::EntityID aEntityID) {
+            out.PushBack(aEntityID);
+        });
+    }
+
+    return out;
+}
+
+Red::EntityID App::DynamicEntitySystem::GetNearestTagged(const Red::Vector4& aCenter, Red::CName aTag,
+                                                         float aMaxDistance)
+{
+    if (!m_ready)
+        return {};
+
+    std::shared_lock _(m_entityStateLock);
+    const auto taggedIt = m_entityStatesByTag.find(aTag);
+
+    if (taggedIt == m_entityStatesByTag.end() || taggedIt.value().empty())
+        return {};
+
+    const auto& tagged = taggedIt.value();
+
+    return m_entityPositions.FindNearest(aCenter, aMaxDistance, [&](Red::EntityID aEntityID) {
+        return tagged.contains(aEntityID);
+    });
+}
+
 void App::DynamicEntitySystem::RegisterListener(Red::CName aTag, const Red::Handle<Red::IScriptable>& aTarget,
                                                 Red::CName aFunction)
 {
     if (!m_ready)
         return;
 
+    if (!aTarget)
+        return;
+
+    Red::CallSite callSite(Red::GetMemberFunction(aTarget->GetType(), aFunction));
+
     std::unique_lock _(m_listenersLock);
 
-    m_listenersByTag[aTag].push_back({aTarget, aFunction});
+    m_listenersByTag[aTag].push_back({aTarget, aFunction, callSite});
 }
 
 void App::DynamicEntitySystem::UnregisterListener(Red::CName aTag, const Red::Handle<Red::IScriptable>& aTarget,
@@ -731,9 +1286,9 @@ void App::DynamicEntitySystem::ProcessListeners(Red::EntityID aEntityID, App::Dy
 
         for (const auto& listener : listeners)
         {
-            if (!listener.target.Expired())
+            if (auto target = listener.target.Lock())
             {
-                Red::CallVirtual(listener.target.Lock(), listener.function, event);
+                listener.callSite(target.GetPtr(), event);
             }
         }
 
@@ -771,15 +1326,41 @@ bool App::DynamicEntitySystem::ValidateEntitySpec(const App::DynamicEntitySpecPt
     return false;
 }
 
+Red::EntityID App::DynamicEntitySystem::GenerateEntityID(const App::DynamicEntitySpecPtr& aEntitySpec)
+{
+    Red::EntityID entityID{};
+
+    if (aEntitySpec->persistState)
+    {
+        m_entityIDSystem->GetNextPersistableID(entityID);
+    }
+    else
+    {
+        m_entityIDSystem->GetNextTransientID(entityID);
+    }
+
+    return entityID;
+}
+
 Red::TweakDBID App::DynamicEntitySystem::ConvertTemplateToRecord(Red::RaRef<> aTemplate)
+{
+    Red::TweakDBBatch recordBatch;
+    const auto recordID = ConvertTemplateToRecord(aTemplate, recordBatch);
+    recordBatch.Commit();
+
+    return recordID;
+}
+
+Red::TweakDBID App::DynamicEntitySystem::ConvertTemplateToRecord(Red::RaRef<> aTemplate,
+                                                                 Red::TweakDBBatch& aRecordBatch)
 {
     const auto hash = Red::FNV1a32(reinterpret_cast<const uint8_t*>(&aTemplate.path), sizeof(Red::ResourcePath));
     const auto recordID = Red::TweakDBID(hash, 1);
 
     if (!Red::RecordExists(recordID))
     {
-        Red::CreateFlat(recordID, ".entityTemplatePath", aTemplate);
-        Red::CreateRecord(recordID, "SpawnableObject");
+        aRecordBatch.CreateFlat(recordID, ".entityTemplatePath", aTemplate);
+        aRecordBatch.CreateRecord(recordID, "SpawnableObject");
     }
 
     return recordID;
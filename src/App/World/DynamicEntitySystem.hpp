@@ -1,9 +1,12 @@
 #pragma once
 
+#include "App/World/DynamicEntityBatchResult.hpp"
 #include "App/World/DynamicEntityEvent.hpp"
 #include "App/World/DynamicEntitySpec.hpp"
 #include "App/World/DynamicEntityState.hpp"
 #include "App/World/DynamicEntitySystemPS.hpp"
+#include "App/World/EntitySpatialIndex.hpp"
+#include "Red/TweakDB.hpp"
 
 namespace App
 {
@@ -16,6 +19,8 @@ public:
     [[nodiscard]] bool IsRestored() const;
 
     Red::EntityID CreateEntity(const DynamicEntitySpecPtr& aEntitySpec);
+    Red::DynArray<Red::EntityID> CreateEntities(const Red::DynArray<DynamicEntitySpecPtr>& aEntitySpecs,
+                                                const Red::Handle<Red::IScriptable>& aTarget, Red::CName aFunction);
     bool DeleteEntity(Red::EntityID aEntityID);
     bool EnableEntity(Red::EntityID aEntityID);
     bool DisableEntity(Red::EntityID aEntityID);
@@ -37,6 +42,10 @@ public:
     void EnableTagged(Red::CName aTag);
     void DisableTagged(Red::CName aTag);
 
+    Red::DynArray<Red::EntityID> GetInRadius(const Red::Vector4& aCenter, float aRadius, Red::CName aTag);
+    Red::DynArray<Red::EntityID> GetInBox(const Red::Vector4& aMin, const Red::Vector4& aMax, Red::CName aTag);
+    Red::EntityID GetNearestTagged(const Red::Vector4& aCenter, Red::CName aTag, float aMaxDistance);
+
     void RegisterListener(Red::CName aTag, const Red::Handle<Red::IScriptable>& aTarget, Red::CName aFunction);
     void UnregisterListener(Red::CName aTag, const Red::Handle<Red::IScriptable>& aTarget, Red::CName aFunction);
     void UnregisterListeners(Red::CName aTag);
@@ -46,8 +55,20 @@ protected:
     {
         Red::WeakHandle<Red::IScriptable> target;
         Red::CName function;
+        Red::CallSite callSite;
+    };
+
+    struct EntityBatch
+    {
+        Core::Vector<DynamicEntityStatePtr> entityStates;
+        Red::Handle<DynamicEntityBatchResult> result;
+        Red::WeakHandle<Red::IScriptable> target;
+        Red::CName function;
+        std::atomic<uint32_t> pending;
     };
 
+    using EntityBatchPtr = Core::SharedPtr<EntityBatch>;
+
     void OnWorldAttached(Red::world::RuntimeScene*) override;
     void OnStreamingWorldLoaded(Red::world::RuntimeScene*, uint64_t aRestored, const Red::JobGroup&) override;
     uint32_t OnBeforeGameSave(const Red::JobGroup&, void*) override;
@@ -56,25 +77,40 @@ protected:
     void OnAfterWorldDetach() override;
     void OnEntitySpawnerEvent(Red::game::EntitySpawnerEventType aType, Red::EntityID aEntityID, Red::EntityID,
                               Red::EntityStub* aStub);
+    void OnRegisterUpdates(Red::UpdateRegistrar* aRegistrar);
+    void OnUpdateTick(Red::FrameInfo& aFrame, Red::JobQueue& aJobQueue);
+
+    void UpdateStreamingQueue(const Red::Vector4& aOrigin);
+    void StreamInEntityState(const DynamicEntityStatePtr& aEntityState);
+    void StreamOutEntityState(const DynamicEntityStatePtr& aEntityState);
+    bool GetPlayerPosition(Red::Vector4& aPosition);
 
     bool SpawnFromEntityState(const DynamicEntityStatePtr& aEntityState);
+    void SpawnFromEntityBatch(const EntityBatchPtr& aEntityBatch, uint32_t aIndex);
+    void ReleaseEntityBatch(const EntityBatchPtr& aEntityBatch);
     bool RespawnFromEntityState(const DynamicEntityStatePtr& aEntityState);
     bool DespawnFromEntityState(const DynamicEntityStatePtr& aEntityState);
     void RegisterPopulation(const App::DynamicEntityStatePtr& aEntityState, bool aRespawn = false);
     void RemovePopulation(const App::DynamicEntityStatePtr& aEntityState);
     void RemovePersistentState(const DynamicEntityStatePtr& aEntityState);
-    void AcquireEntityStub(const App::DynamicEntityStatePtr& aEntityState, Red::EntityStubTokenPtr& aToken);
+    bool AcquireEntityStub(const App::DynamicEntityStatePtr& aEntityState, Red::EntityStubTokenPtr& aToken);
+    void DiscardEntityStub(const DynamicEntityStatePtr& aEntityState);
     void ResetEntityStub(const DynamicEntityStatePtr& aEntityState);
     void RemoveEntityStub(const DynamicEntityStatePtr& aEntityState);
 
     DynamicEntityStatePtr CreateEntityState(Red::EntityID aEntityID, const DynamicEntitySpecPtr& aEntitySpec);
-    void RestoreEntityState(const DynamicEntityStatePtr& aEntityState);
+    void RestoreEntityState(const DynamicEntityStatePtr& aEntityState, Red::TweakDBBatch& aRecordBatch);
     void AddEntityState(const DynamicEntityStatePtr& aEntityState);
+    void AddEntityStates(const Core::Vector<DynamicEntityStatePtr>& aEntityStates);
+    void AddStreamedPosition(const DynamicEntityStatePtr& aEntityState);
     void UpdateTransientID(const DynamicEntityStatePtr& aEntityState);
+    void UpdateEntityPosition(Red::EntityID aEntityID);
     DynamicEntityStatePtr RemoveEntityState(Red::EntityID aEntityID);
 
     bool ValidateEntitySpec(const DynamicEntitySpecPtr& aEntitySpec);
+    Red::EntityID GenerateEntityID(const DynamicEntitySpecPtr& aEntitySpec);
     Red::TweakDBID ConvertTemplateToRecord(Red::RaRef<> aTemplate);
+    Red::TweakDBID ConvertTemplateToRecord(Red::RaRef<> aTemplate, Red::TweakDBBatch& aRecordBatch);
 
     void ProcessListeners(Red::EntityID aEntityID, DynamicEntityEventType aType, Red::DynArray<Red::CName>& aTags);
     void ProcessListeners(Red::EntityID aEntityID, DynamicEntityEventType aType);
@@ -87,6 +123,15 @@ protected:
     Core::Vector<DynamicEntityStatePtr> m_entityStates;
     Core::Map<Red::EntityID, DynamicEntityStatePtr> m_entityStateByID;
     Core::Map<Red::CName, Core::Set<Red::EntityID>> m_entityStatesByTag;
+    EntitySpatialIndex m_entityPositions;
+    EntitySpatialIndex m_streamedPositions;
+    Core::Set<Red::EntityID> m_streamedInIDs;
+    std::atomic<uint32_t> m_streamedCount{0};
+    float m_maxStreamingDistance{0};
+
+    Core::Vector<DynamicEntityStatePtr> m_streamingQueue;
+    Red::Vector4 m_streamingOrigin;
+    std::atomic<bool> m_streamingDirty;
 
     std::shared_mutex m_listenersLock;
     Core::Map<Red::CName, Core::Vector<EventListener>> m_listenersByTag;
@@ -99,6 +144,8 @@ protected:
     Red::IDynamicEntityIDSystem* m_entityIDSystem;
     Red::IEntityStubSystem* m_entityStubSystem;
     Red::IPopulationSystem* m_populationSystem;
+    Red::gameIPlayerSystem* m_playerSystem;
+    Red::CallSite m_playerCallSite;
     Red::IEntitySpawnerEventsBroadcaster* m_spawnEventBroadcaster;
     Red::worldRuntimeEntityRegistry* m_entityRegistry;
     Red::redTagSystem* m_entityTagSystem;
@@ -113,6 +160,7 @@ RTTI_DEFINE_CLASS(App::DynamicEntitySystem, {
     RTTI_GETTER(m_restored);
 
     RTTI_METHOD(CreateEntity);
+    RTTI_METHOD(CreateEntities);
     RTTI_METHOD(DeleteEntity);
     RTTI_METHOD(EnableEntity);
     RTTI_METHOD(DisableEntity);
@@ -134,6 +182,10 @@ RTTI_DEFINE_CLASS(App::DynamicEntitySystem, {
     RTTI_METHOD(EnableTagged);
     RTTI_METHOD(DisableTagged);
 
+    RTTI_METHOD(GetInRadius);
+    RTTI_METHOD(GetInBox);
+    RTTI_METHOD(GetNearestTagged);
+
     RTTI_METHOD(RegisterListener);
     RTTI_METHOD(UnregisterListener);
     RTTI_METHOD(UnregisterListeners);
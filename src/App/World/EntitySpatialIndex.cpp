@@ -0,0 +1,135 @@
+#include "EntitySpatialIndex.hpp"
+
+App::EntitySpatialIndex::EntitySpatialIndex(float aCellSize)
+    : m_cellSize(aCellSize)
+    , m_cellSizeInv(1.0f / aCellSize)
+    , m_minCellX(std::numeric_limits<int32_t>::max())
+    , m_minCellY(std::numeric_limits<int32_t>::max())
+    , m_maxCellX(std::numeric_limits<int32_t>::min())
+    , m_maxCellY(std::numeric_limits<int32_t>::min())
+{
+}
+
+void App::EntitySpatialIndex::Insert(Red::EntityID aEntityID, const Red::Vector4& aPosition)
+{
+    const auto cellX = GetCellCoord(aPosition.X);
+    const auto cellY = GetCellCoord(aPosition.Y);
+    const auto cellKey = GetCellKey(cellX, cellY);
+
+    auto cellKeyIt = m_cellByEntity.find(aEntityID);
+
+    if (cellKeyIt != m_cellByEntity.end())
+    {
+        const auto currentCellKey = cellKeyIt.value();
+        auto cellIt = m_cells.find(currentCellKey);
+
+        if (cellIt != m_cells.end())
+        {
+            auto& entries = cellIt.value();
+            auto entryIt = std::ranges::find(entries, aEntityID, &Entry::entityID);
+
+            if (entryIt != entries.end())
+            {
+                if (currentCellKey == cellKey)
+                {
+                    entryIt->position = aPosition;
+                    return;
+                }
+
+                *entryIt = entries.back();
+                entries.pop_back();
+
+                if (entries.empty())
+                {
+                    m_cells.erase(cellIt);
+                }
+            }
+        }
+
+        cellKeyIt.value() = cellKey;
+    }
+    else
+    {
+        m_cellByEntity.emplace(aEntityID, cellKey);
+    }
+
+    m_cells[cellKey].push_back({aEntityID, aPosition});
+
+    m_minCellX = std::min(m_minCellX, cellX);
+    m_minCellY = std::min(m_minCellY, cellY);
+    m_maxCellX = std::max(m_maxCellX, cellX);
+    m_maxCellY = std::max(m_maxCellY, cellY);
+}
+
+bool App::EntitySpatialIndex::Remove(Red::EntityID aEntityID)
+{
+    auto cellKeyIt = m_cellByEntity.find(aEntityID);
+
+    if (cellKeyIt == m_cellByEntity.end())
+        return false;
+
+    auto cellIt = m_cells.find(cellKeyIt.value());
+
+    if (cellIt != m_cells.end())
+    {
+        auto& entries = cellIt.value();
+        auto entryIt = std::ranges::find(entries, aEntityID, &Entry::entityID);
+
+        if (entryIt != entries.end())
+        {
+            *entryIt = entries.back();
+            entries.pop_back();
+        }
+
+        if (entries.empty())
+        {
+            m_cells.erase(cellIt);
+        }
+    }
+
+    m_cellByEntity.erase(cellKeyIt);
+
+    return true;
+}
+
+void App::EntitySpatialIndex::Clear()
+{
+    m_cells.clear();
+    m_cellByEntity.clear();
+
+    m_minCellX = std::numeric_limits<int32_t>::max();
+    m_minCellY = std::numeric_limits<int32_t>::max();
+    m_maxCellX = std::numeric_limits<int32_t>::min();
+    m_maxCellY = std::numeric_limits<int32_t>::min();
+}
+
+bool App::EntitySpatialIndex::Contains(Red::EntityID aEntityID) const
+{
+    return m_cellByEntity.contains(aEntityID);
+}
+
+bool App::EntitySpatialIndex::GetPosition(Red::EntityID aEntityID, Red::Vector4& aPosition) const
+{
+    const auto cellKeyIt = m_cellByEntity.find(aEntityID);
+
+    if (cellKeyIt == m_cellByEntity.end())
+        return false;
+
+    const auto cellIt = m_cells.find(cellKeyIt->second);
+
+    if (cellIt == m_cells.end())
+        return false;
+
+    const auto entryIt = std::ranges::find(cellIt->second, aEntityID, &Entry::entityID);
+
+    if (entryIt == cellIt->second.end())
+        return false;
+
+    aPosition = entryIt->position;
+    return true;
+}
+
+size_t App::EntitySpatialIndex::GetSize() const
+{
+    return m_cellByEntity.size();
+}
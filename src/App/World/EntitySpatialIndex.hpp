@@ -0,0 +1,225 @@
+#pragma once
+
+namespace App
+{
+// Uniform grid over the horizontal plane, entities are bucketed by the cell
+// their position falls into, vertical coordinate is only used for filtering.
+class EntitySpatialIndex
+{
+public:
+    static constexpr float DefaultCellSize = 32.0f;
+    static constexpr float MaxCoordinate = 1.0e6f;
+
+    explicit EntitySpatialIndex(float aCellSize = DefaultCellSize);
+
+    void Insert(Red::EntityID aEntityID, const Red::Vector4& aPosition);
+    bool Remove(Red::EntityID aEntityID);
+    void Clear();
+
+    [[nodiscard]] bool Contains(Red::EntityID aEntityID) const;
+    [[nodiscard]] bool GetPosition(Red::EntityID aEntityID, Red::Vector4& aPosition) const;
+    [[nodiscard]] size_t GetSize() const;
+
+    template<typename Callback>
+    void ForEachInBox(const Red::Vector4& aMin, const Red::Vector4& aMax, Callback&& aCallback) const
+    {
+        if (!IsValidPosition(aMin) || !IsValidPosition(aMax))
+            return;
+
+        ForEachCellInRange(GetCellCoord(aMin.X), GetCellCoord(aMin.Y), GetCellCoord(aMax.X), GetCellCoord(aMax.Y),
+                           [&](const Core::Vector<Entry>& aEntries) {
+                               for (const auto& entry : aEntries)
+                               {
+                                   if (entry.position.X >= aMin.X && entry.position.X <= aMax.X &&
+                                       entry.position.Y >= aMin.Y && entry.position.Y <= aMax.Y &&
+                                       entry.position.Z >= aMin.Z && entry.position.Z <= aMax.Z)
+                                   {
+                                       aCallback(entry.entityID);
+                                   }
+                               }
+                           });
+    }
+
+    template<typename Callback>
+    void ForEachInRadius(const Red::Vector4& aCenter, float aRadius, Callback&& aCallback) const
+    {
+        if (!IsValidPosition(aCenter) || !(aRadius >= 0))
+            return;
+
+        aRadius = std::min(aRadius, 2 * MaxCoordinate);
+
+        const auto radiusSq = aRadius * aRadius;
+
+        ForEachCellInRange(GetCellCoord(aCenter.X - aRadius), GetCellCoord(aCenter.Y - aRadius),
+                           GetCellCoord(aCenter.X + aRadius), GetCellCoord(aCenter.Y + aRadius),
+                           [&](const Core::Vector<Entry>& aEntries) {
+                               for (const auto& entry : aEntries)
+                               {
+                                   if (GetDistanceSq(aCenter, entry.position) <= radiusSq)
+                                   {
+                                       aCallback(entry.entityID);
+                                   }
+                               }
+                           });
+    }
+
+    template<typename Predicate>
+    Red::EntityID FindNearest(const Red::Vector4& aCenter, float aMaxDistance, Predicate&& aPredicate) const
+    {
+        if (m_cells.empty() || !IsValidPosition(aCenter) || std::isnan(aMaxDistance))
+            return {};
+
+        const auto centerX = GetCellCoord(aCenter.X);
+        const auto centerY = GetCellCoord(aCenter.Y);
+
+        // Without a distance limit the search stops at the bounds of occupied cells
+        int32_t maxRing = std::max({centerX - m_minCellX, m_maxCellX - centerX,
+                                    centerY - m_minCellY, m_maxCellY - centerY, 0});
+
+        auto bestDistanceSq = std::numeric_limits<float>::infinity();
+
+        if (aMaxDistance > 0)
+        {
+            maxRing = std::min(maxRing, GetCellCoord(aMaxDistance) + 1);
+            bestDistanceSq = aMaxDistance * aMaxDistance;
+        }
+
+        Red::EntityID bestEntityID{};
+
+        const auto visitEntries = [&](const Core::Vector<Entry>& aEntries) {
+            for (const auto& entry : aEntries)
+            {
+                const auto distanceSq = GetDistanceSq(aCenter, entry.position);
+
+                if (distanceSq <= bestDistanceSq && aPredicate(entry.entityID))
+                {
+                    bestDistanceSq = distanceSq;
+                    bestEntityID = entry.entityID;
+                }
+            }
+        };
+
+        for (int32_t ring = 0; ring <= maxRing; ++ring)
+        {
+            // Any point in the ring is at least this far from the center
+            const auto ringDistance = static_cast<float>(ring - 1) * m_cellSize;
+
+            if (ring > 1 && ringDistance * ringDistance > bestDistanceSq)
+                break;
+
+            // When the ring gets wider than the number of occupied cells, finish with a single full pass
+            if (static_cast<size_t>(ring) * 8 > m_cells.size())
+            {
+                for (const auto& [cellKey, entries] : m_cells)
+                {
+                    visitEntries(entries);
+                }
+                break;
+            }
+
+            if (ring == 0)
+            {
+                ForEachCellInRange(centerX, centerY, centerX, centerY, visitEntries);
+                continue;
+            }
+
+            ForEachCellInRange(centerX - ring, centerY - ring, centerX + ring, centerY - ring, visitEntries);
+            ForEachCellInRange(centerX - ring, centerY + ring, centerX + ring, centerY + ring, visitEntries);
+            ForEachCellInRange(centerX - ring, centerY - ring + 1, centerX - ring, centerY + ring - 1, visitEntries);
+            ForEachCellInRange(centerX + ring, centerY - ring + 1, centerX + ring, centerY + ring - 1, visitEntries);
+        }
+
+        return bestEntityID;
+    }
+
+private:
+    struct Entry
+    {
+        Red::EntityID entityID;
+        Red::Vector4 position;
+    };
+
+    using CellKey = uint64_t;
+
+    static constexpr float MaxCellCoord = 1 << 24;
+
+    template<typename Callback>
+    void ForEachCellInRange(int32_t aMinX, int32_t aMinY, int32_t aMaxX, int32_t aMaxY, Callback&& aCallback) const
+    {
+        const auto rangeSize = static_cast<uint64_t>(aMaxX - aMinX + 1) * static_cast<uint64_t>(aMaxY - aMinY + 1);
+
+        // For very large areas it's cheaper to check every occupied cell
+        if (rangeSize > m_cells.size())
+        {
+            for (const auto& [cellKey, entries] : m_cells)
+            {
+                const auto [cellX, cellY] = GetCellCoords(cellKey);
+
+                if (cellX >= aMinX && cellX <= aMaxX && cellY >= aMinY && cellY <= aMaxY)
+                {
+                    aCallback(entries);
+                }
+            }
+            return;
+        }
+
+        for (auto cellX = aMinX; cellX <= aMaxX; ++cellX)
+        {
+            for (auto cellY = aMinY; cellY <= aMaxY; ++cellY)
+            {
+                const auto& cellIt = m_cells.find(GetCellKey(cellX, cellY));
+
+                if (cellIt != m_cells.end())
+                {
+                    aCallback(cellIt.value());
+                }
+            }
+        }
+    }
+
+    // Coordinates are clamped to the world range before conversion, so cell coordinates and
+    // the size of any cell range stay far from the int32 limits, NaN maps to the origin cell
+    [[nodiscard]] inline int32_t GetCellCoord(float aValue) const
+    {
+        if (std::isnan(aValue))
+            return 0;
+
+        const auto cell = std::floor(std::clamp(aValue, -MaxCoordinate, MaxCoordinate) * m_cellSizeInv);
+
+        return static_cast<int32_t>(std::clamp(cell, -MaxCellCoord, MaxCellCoord));
+    }
+
+    inline static bool IsValidPosition(const Red::Vector4& aPosition)
+    {
+        return !std::isnan(aPosition.X) && !std::isnan(aPosition.Y) && !std::isnan(aPosition.Z);
+    }
+
+    inline static CellKey GetCellKey(int32_t aX, int32_t aY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(aX)) << 32) | static_cast<uint32_t>(aY);
+    }
+
+    inline static std::pair<int32_t, int32_t> GetCellCoords(CellKey aKey)
+    {
+        return {static_cast<int32_t>(aKey >> 32), static_cast<int32_t>(aKey & 0xFFFFFFFF)};
+    }
+
+    inline static float GetDistanceSq(const Red::Vector4& aA, const Red::Vector4& aB)
+    {
+        const auto dx = aA.X - aB.X;
+        const auto dy = aA.Y - aB.Y;
+        const auto dz = aA.Z - aB.Z;
+
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    float m_cellSize;
+    float m_cellSizeInv;
+    int32_t m_minCellX;
+    int32_t m_minCellY;
+    int32_t m_maxCellX;
+    int32_t m_maxCellY;
+    Core::Map<CellKey, Core::Vector<Entry>> m_cells;
+    Core::Map<Red::EntityID, CellKey> m_cellByEntity;
+};
+}
@@ -1,4 +1,5 @@
 #include "OpenWorldSystem.hpp"
+#include "App/World/OpenWorldTracker.hpp"
 #include "Core/Facades/Container.hpp"
 #include "Core/Facades/Log.hpp"
 #include "Red/CommunitySystem.hpp"
@@ -27,20 +28,43 @@ void App::OpenWorldSystem::OnWorldAttached(Red::world::RuntimeScene*)
 void App::OpenWorldSystem::OnAfterWorldDetach()
 {
     m_ready = false;
+
+    OpenWorldTracker::ResetMappinPhases();
 }
 
 bool App::OpenWorldSystem::OnGameRestored()
 {
+    OpenWorldTracker::ResetMappinPhases();
+
     m_questPhaseRegistry->InitializeActivities();
 
     return true;
 }
 
+void App::OpenWorldSystem::OnRegisterUpdates(Red::UpdateRegistrar* aRegistrar)
+{
+    aRegistrar->RegisterUpdate(Red::UpdateTickGroup::FrameBegin, this, "OpenWorldSystem/Tick",
+                               {this, &OpenWorldSystem::OnUpdateTick});
+}
+
+void App::OpenWorldSystem::OnUpdateTick(Red::FrameInfo& aFrame, Red::JobQueue& aJobQueue)
+{
+    if (!m_ready)
+        return;
+
+    m_questPhaseRegistry->FinalizeActivities();
+}
+
 bool App::OpenWorldSystem::IsReady()
 {
     return m_ready && m_questPhaseRegistry->ActivitiesInitialized();
 }
 
+float App::OpenWorldSystem::GetLoadingProgress()
+{
+    return m_questPhaseRegistry->GetActivitiesProgress();
+}
+
 App::OpenWorldActivityState App::OpenWorldSystem::GetActivity(Red::CName aName)
 {
     const auto& activity = m_questPhaseRegistry->FindActivity(aName);
@@ -51,13 +75,23 @@ App::OpenWorldActivityState App::OpenWorldSystem::GetActivity(Red::CName aName)
     return MakeActivityState(activity);
 }
 
-Red::DynArray<App::OpenWorldActivityState> App::OpenWorldSystem::GetActivities()
+Red::DynArray<App::OpenWorldActivityState> App::OpenWorldSystem::GetActivities(
+    Red::Optional<OpenWorldActivityRequest>& aRequest)
 {
     Red::DynArray<OpenWorldActivityState> states;
+    uint32_t gameTime = 0;
+    float realTimeMultiplier = 1.0;
 
-    for (const auto& activity : m_questPhaseRegistry->GetAllActivities())
+    GetRequestTime(aRequest, gameTime, realTimeMultiplier);
+
+    for (const auto& activity : m_questPhaseRegistry->FindActivities(aRequest->kind, aRequest->districts))
     {
-        states.EmplaceBack(MakeActivityState(activity));
+        auto state = MakeActivityState(activity);
+
+        if (!aRequest->Match(state, gameTime, realTimeMultiplier))
+            continue;
+
+        states.EmplaceBack(std::move(state));
     }
 
     return states;
@@ -90,16 +124,11 @@ int32_t App::OpenWorldSystem::StartActivities(Red::Optional<OpenWorldActivityReq
     uint32_t gameTime = 0;
     float realTimeMultiplier = 1.0;
 
-    if (aRequest->HasCooldown())
-    {
-        Red::ScriptGameInstance game;
-        Red::CallStatic("ScriptGameInstance", "GetGameTime", gameTime, game);
-        realTimeMultiplier = Red::GetFlatValue<float>("timeSystem.settings.realTimeMultiplier");
-    }
+    GetRequestTime(aRequest, gameTime, realTimeMultiplier);
 
-    for (const auto& activity : m_questPhaseRegistry->GetAllActivities())
+    for (const auto& activity : m_questPhaseRegistry->FindActivities(aRequest->kind, aRequest->districts))
     {
-        auto state = MakeActivityState(activity);
+        auto state = MakeActivityState(activity, false);
 
         if (!state.completed)
         {
@@ -110,8 +139,13 @@ int32_t App::OpenWorldSystem::StartActivities(Red::Optional<OpenWorldActivityReq
                 continue;
         }
 
-        if (!aRequest->Match(state, gameTime, realTimeMultiplier))
-            continue;
+        if (aRequest->HasCooldown())
+        {
+            state.timestamp = Raw::JournalManager::GetEntryTimestamp(m_journalManager, activity->mappinEntry);
+
+            if (!aRequest->Match(state, gameTime, realTimeMultiplier))
+                continue;
+        }
 
         if (ProcessActivity(activity) == OpenWorldActivityResult::OK)
         {
@@ -123,21 +157,54 @@ int32_t App::OpenWorldSystem::StartActivities(Red::Optional<OpenWorldActivityReq
 }
 
 App::OpenWorldActivityState App::OpenWorldSystem::MakeActivityState(
-    const Core::SharedPtr<App::ActivityDefinition>& aActivity)
+    const Core::SharedPtr<App::ActivityDefinition>& aActivity, bool aResolveTimestamp)
 {
     OpenWorldActivityState state(aActivity);
-    state.timestamp = Raw::JournalManager::GetEntryTimestamp(m_journalManager, aActivity->mappinEntry);
 
-    auto phase = Raw::MappinSystem::GetPoiMappinPhase(m_mappinSystem, aActivity->mappinHash);
+    if (aResolveTimestamp)
+    {
+        state.timestamp = Raw::JournalManager::GetEntryTimestamp(m_journalManager, aActivity->mappinEntry);
+    }
+
+    auto phase = GetMappinPhase(aActivity);
     state.completed = (phase == Red::gamedataMappinPhase::CompletedPhase);
     state.discovered = state.completed || (phase == Red::gamedataMappinPhase::DiscoveredPhase);
 
     return state;
 }
 
+Red::gamedataMappinPhase App::OpenWorldSystem::GetMappinPhase(
+    const Core::SharedPtr<App::ActivityDefinition>& aActivity)
+{
+    Red::gamedataMappinPhase phase;
+
+    if (!OpenWorldTracker::GetMappinPhase(aActivity->mappinHash, phase))
+    {
+        phase = Raw::MappinSystem::GetPoiMappinPhase(m_mappinSystem, aActivity->mappinHash);
+
+        if (phase != Red::gamedataMappinPhase::Invalid)
+        {
+            OpenWorldTracker::SetMappinPhase(aActivity->mappinHash, phase);
+        }
+    }
+
+    return phase;
+}
+
+void App::OpenWorldSystem::GetRequestTime(const OpenWorldActivityRequest& aRequest, uint32_t& aGameTime,
+                                          float& aRealTimeMultiplier)
+{
+    if (aRequest.HasCooldown())
+    {
+        Red::ScriptGameInstance game;
+        Red::CallStatic("ScriptGameInstance", "GetGameTime", aGameTime, game);
+        aRealTimeMultiplier = Red::GetFlatValue<float>("timeSystem.settings.realTimeMultiplier");
+    }
+}
+
 bool App::OpenWorldSystem::IsActivityCompleted(const Core::SharedPtr<App::ActivityDefinition>& aActivity)
 {
-    auto phase = Raw::MappinSystem::GetPoiMappinPhase(m_mappinSystem, aActivity->mappinHash);
+    auto phase = GetMappinPhase(aActivity);
     if (phase != Red::gamedataMappinPhase::Invalid)
     {
         return phase == Red::gamedataMappinPhase::CompletedPhase;
@@ -358,6 +425,7 @@ App::OpenWorldActivityResult App::OpenWorldSystem::ProcessActivity(
     {
         Raw::MappinSystem::SetPoiMappinPhase(m_mappinSystem, aActivity->mappinHash,
                                              Red::gamedataMappinPhase::DiscoveredPhase);
+        OpenWorldTracker::SetMappinPhase(aActivity->mappinHash, Red::gamedataMappinPhase::DiscoveredPhase);
     }
 
     if (aActivity->phaseGraph)
@@ -383,14 +451,9 @@ void App::OpenWorldSystem::PrintActivities(Red::Optional<OpenWorldActivityReques
     uint32_t gameTime = 0;
     float realTimeMultiplier = 1.0;
 
-    if (aRequest->HasCooldown())
-    {
-        Red::ScriptGameInstance game;
-        Red::CallStatic("ScriptGameInstance", "GetGameTime", gameTime, game);
-        realTimeMultiplier = Red::GetFlatValue<float>("timeSystem.settings.realTimeMultiplier");
-    }
+    GetRequestTime(aRequest, gameTime, realTimeMultiplier);
 
-    for (const auto& activity : m_questPhaseRegistry->GetAllActivities())
+    for (const auto& activity : m_questPhaseRegistry->FindActivities(aRequest->kind, aRequest->districts))
     {
         auto state = MakeActivityState(activity);
 
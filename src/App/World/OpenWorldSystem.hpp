@@ -49,9 +49,10 @@ class OpenWorldSystem : public Red::IGameSystem
 {
 public:
     bool IsReady();
+    float GetLoadingProgress();
 
     OpenWorldActivityState GetActivity(Red::CName aName);
-    Red::DynArray<OpenWorldActivityState> GetActivities();
+    Red::DynArray<OpenWorldActivityState> GetActivities(Red::Optional<OpenWorldActivityRequest>& aRequest);
 
     OpenWorldActivityResult StartActivity(Red::CName aName, Red::Optional<bool> aForce);
     int32_t StartActivities(Red::Optional<OpenWorldActivityRequest>& aRequest);
@@ -64,8 +65,14 @@ private:
     void OnAfterWorldDetach() override;
     bool OnGameRestored() override;
 
+    void OnRegisterUpdates(Red::UpdateRegistrar* aRegistrar);
+    void OnUpdateTick(Red::FrameInfo& aFrame, Red::JobQueue& aJobQueue);
+
     bool IsActivityCompleted(const Core::SharedPtr<ActivityDefinition>& aActivity);
-    OpenWorldActivityState MakeActivityState(const Core::SharedPtr<ActivityDefinition>& aActivity);
+    Red::gamedataMappinPhase GetMappinPhase(const Core::SharedPtr<ActivityDefinition>& aActivity);
+    OpenWorldActivityState MakeActivityState(const Core::SharedPtr<ActivityDefinition>& aActivity,
+                                             bool aResolveTimestamp = true);
+    void GetRequestTime(const OpenWorldActivityRequest& aRequest, uint32_t& aGameTime, float& aRealTimeMultiplier);
     OpenWorldActivityResult ProcessActivity(const Core::SharedPtr<ActivityDefinition>& aActivity);
 
     bool m_ready;
@@ -107,6 +114,7 @@ RTTI_DEFINE_CLASS(App::OpenWorldActivityRequest, {
 
 RTTI_DEFINE_CLASS(App::OpenWorldSystem, {
     RTTI_GETTER(m_ready);
+    RTTI_METHOD(GetLoadingProgress);
     RTTI_METHOD(GetActivity);
     RTTI_METHOD(GetActivities);
     RTTI_METHOD(StartActivity);
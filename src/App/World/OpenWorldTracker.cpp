@@ -1,5 +1,4 @@
 #include "OpenWorldTracker.hpp"
-#include "Red/JournalManager.hpp"
 
 void App::OpenWorldTracker::OnBootstrap()
 {
@@ -8,10 +7,13 @@ void App::OpenWorldTracker::OnBootstrap()
 
 void App::OpenWorldTracker::OnSetPoiMappinPhase(void* aMappin, Red::gamedataMappinPhase aMappinPhase)
 {
+    auto& journalHash = Raw::PointOfInterestMappin::JournalHash::Ref(aMappin);
+
+    SetMappinPhase(journalHash, aMappinPhase);
+
     if (aMappinPhase == Red::gamedataMappinPhase::CompletedPhase)
     {
         auto journalManager = Red::GetGameSystem<Red::gameIJournalManager>();
-        auto& journalHash = Raw::PointOfInterestMappin::JournalHash::Ref(aMappin);
 
         Red::Handle<Red::gameJournalEntry> entry;
         Raw::JournalManager::GetEntryByHash(journalManager, entry, journalHash);
@@ -25,3 +27,27 @@ void App::OpenWorldTracker::OnSetPoiMappinPhase(void* aMappin, Red::gamedataMapp
         }
     }
 }
+
+bool App::OpenWorldTracker::GetMappinPhase(Red::JournalEntryHash aJournalHash, Red::gamedataMappinPhase& aMappinPhase)
+{
+    std::shared_lock _(s_mappinPhasesLock);
+    const auto& it = s_mappinPhases.find(aJournalHash);
+
+    if (it == s_mappinPhases.end())
+        return false;
+
+    aMappinPhase = it->second;
+    return true;
+}
+
+void App::OpenWorldTracker::SetMappinPhase(Red::JournalEntryHash aJournalHash, Red::gamedataMappinPhase aMappinPhase)
+{
+    std::unique_lock _(s_mappinPhasesLock);
+    s_mappinPhases[aJournalHash] = aMappinPhase;
+}
+
+void App::OpenWorldTracker::ResetMappinPhases()
+{
+    std::unique_lock _(s_mappinPhasesLock);
+    s_mappinPhases.clear();
+}
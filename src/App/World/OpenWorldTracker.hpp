@@ -3,6 +3,7 @@
 #include "Core/Foundation/Feature.hpp"
 #include "Core/Hooking/HookingAgent.hpp"
 #include "Core/Logging/LoggingAgent.hpp"
+#include "Red/JournalManager.hpp"
 #include "Red/MappinSystem.hpp"
 
 namespace App
@@ -12,8 +13,16 @@ class OpenWorldTracker
     , public Core::HookingAgent
     , public Core::LoggingAgent
 {
+public:
+    static bool GetMappinPhase(Red::JournalEntryHash aJournalHash, Red::gamedataMappinPhase& aMappinPhase);
+    static void SetMappinPhase(Red::JournalEntryHash aJournalHash, Red::gamedataMappinPhase aMappinPhase);
+    static void ResetMappinPhases();
+
 protected:
     void OnBootstrap() override;
     static void OnSetPoiMappinPhase(void* aMappin, Red::gamedataMappinPhase aMappinPhase);
+
+    inline static std::shared_mutex s_mappinPhasesLock;
+    inline static Core::Map<Red::JournalEntryHash, Red::gamedataMappinPhase> s_mappinPhases;
 };
 }
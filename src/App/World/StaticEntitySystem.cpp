@@ -31,7 +31,7 @@ void App::StaticEntitySystem::OnAfterWorldDetach()
 {
     m_ready = false;
 
-    std::scoped_lock _(m_entitiesLock, m_tagsLock, m_disposedLock);
+    std::scoped_lock _(m_entitiesLock, m_tagsLock, m_positionsLock, m_disposedLock);
 
     for (auto& [entityID, entity] : m_entities)
     {
@@ -44,6 +44,7 @@ void App::StaticEntitySystem::OnAfterWorldDetach()
     m_entities.clear();
     m_entityIDsByTag.clear();
     m_tagsByEntityID.clear();
+    m_positions.Clear();
     m_disposed.clear();
 }
 
@@ -90,6 +91,11 @@ void App::StaticEntitySystem::OnUpdateTick(Red::FrameInfo& aFrame, Red::JobQueue
             }
         }
 
+        {
+            std::scoped_lock positionsLockRW(m_positionsLock);
+            m_positions.Remove(entityID);
+        }
+
         it = m_disposed.erase(it);
     }
 }
@@ -160,6 +166,11 @@ Red::EntityID App::StaticEntitySystem::SpawnEntity(const StaticEntitySpecPtr& aE
         }
     }
 
+    {
+        std::scoped_lock _(m_positionsLock);
+        m_positions.Insert(entityID, aEntitySpec->position);
+    }
+
     return entityID;
 }
 
@@ -202,6 +213,12 @@ bool App::StaticEntitySystem::DespawnEntity(Red::EntityID aEntityID)
         }
     }
 
+    if (tokenRemoved && !entityRemoved)
+    {
+        std::scoped_lock _(m_positionsLock);
+        m_positions.Remove(aEntityID);
+    }
+
     return tokenRemoved || entityRemoved;
 }
 
@@ -509,6 +526,98 @@ void App::StaticEntitySystem::DetachTagged(Red::CName aTag)
     }
 }
 
+Red::DynArray<Red::EntityID> App::StaticEntitySystem::GetInRadius(const Red::Vector4& aCenter, float aRadius,
+                                                                 Red::CName aTag)
+{
+    if (!m_ready)
+        return {};
+
+    std::shared_lock positionsLockR(m_positionsLock);
+    std::shared_lock tagsLockR(m_tagsLock);
+
+    Red::DynArray<Red::EntityID> out;
+
+    if (aTag)
+    {
+        auto entityIDsEntry = m_entityIDsByTag.find(aTag);
+        if (entityIDsEntry == m_entityIDsByTag.end())
+            return {};
+
+        const auto& entityIDs = entityIDsEntry.value();
+
+        m_positions.ForEachInRadius(aCenter, aRadius, [&](Red::EntityID aEntityID) {
+            if (entityIDs.contains(aEntityID))
+            {
+                out.PushBack(aEntityID);
+            }
+        });
+    }
+    else
+    {
+        m_positions.ForEachInRadius(aCenter, aRadius, [&](Red::EntityID aEntityID) {
+            out.PushBack(aEntityID);
+        });
+    }
+
+    return out;
+}
+
+Red::DynArray<Red::EntityID> App::StaticEntitySystem::GetInBox(const Red::Vector4& aMin, const Red::Vector4& aMax,
+                                                              Red::CName aTag)
+{
+    if (!m_ready)
+        return {};
+
+    std::shared_lock positionsLockR(m_positionsLock);
+    std::shared_lock tagsLockR(m_tagsLock);
+
+    Red::DynArray<Red::EntityID> out;
+
+    if (aTag)
+    {
+        auto entityIDsEntry = m_entityIDsByTag.find(aTag);
+        if (entityIDsEntry == m_entityIDsByTag.end())
+            return {};
+
+        const auto& entityIDs = entityIDsEntry.value();
+
+        m_positions.ForEachInBox(aMin, aMax, [&](Red::EntityID aEntityID) {
+            if (entityIDs.contains(aEntityID))
+            {
+                out.PushBack(aEntityID);
+            }
+        });
+    }
+    else
+    {
+        m_positions.ForEachInBox(aMin, aMax, [&](Red::EntityID aEntityID) {
+            out.PushBack(aEntityID);
+        });
+    }
+
+    return out;
+}
+
+Red::EntityID App::StaticEntitySystem::GetNearestTagged(const Red::Vector4& aCenter, Red::CName aTag,
+                                                        float aMaxDistance)
+{
+    if (!m_ready)
+        return {};
+
+    std::shared_lock positionsLockR(m_positionsLock);
+    std::shared_lock tagsLockR(m_tagsLock);
+
+    auto entityIDsEntry = m_entityIDsByTag.find(aTag);
+    if (entityIDsEntry == m_entityIDsByTag.end() || entityIDsEntry.value().empty())
+        return {};
+
+    const auto& entityIDs = entityIDsEntry.value();
+
+    return m_positions.FindNearest(aCenter, aMaxDistance, [&](Red::EntityID aEntityID) {
+        return entityIDs.contains(aEntityID);
+    });
+}
+
 bool App::StaticEntitySystem::ValidateEntitySpec(const App::StaticEntitySpecPtr& aEntitySpec)
 {
     return Red::ResourceDepot::Get()->ResourceExists(aEntitySpec->templatePath.path);
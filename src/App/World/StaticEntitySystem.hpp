@@ -1,5 +1,6 @@
 #pragma once
 
+#include "App/World/EntitySpatialIndex.hpp"
 #include "App/World/StaticEntitySpec.hpp"
 #include "Red/EntitySpawner.hpp"
 
@@ -34,6 +35,10 @@ public:
     void AttachTagged(Red::CName aTag);
     void DetachTagged(Red::CName aTag);
 
+    Red::DynArray<Red::EntityID> GetInRadius(const Red::Vector4& aCenter, float aRadius, Red::CName aTag);
+    Red::DynArray<Red::EntityID> GetInBox(const Red::Vector4& aMin, const Red::Vector4& aMax, Red::CName aTag);
+    Red::EntityID GetNearestTagged(const Red::Vector4& aCenter, Red::CName aTag, float aMaxDistance);
+
 protected:
     void OnWorldAttached(Red::world::RuntimeScene*) override;
     void OnBeforeWorldDetach(Red::world::RuntimeScene* aScene) override;
@@ -55,6 +60,9 @@ protected:
     Core::Map<Red::EntityID, Core::Set<Red::CName>> m_tagsByEntityID;
     Core::Map<Red::CName, Core::Set<Red::EntityID>> m_entityIDsByTag;
 
+    std::shared_mutex m_positionsLock;
+    EntitySpatialIndex m_positions;
+
     std::shared_mutex m_disposedLock;
     Core::Map<Red::EntityID, Red::Handle<Red::Entity>> m_disposed;
 
@@ -92,4 +100,8 @@ RTTI_DEFINE_CLASS(App::StaticEntitySystem, {
     RTTI_METHOD(DespawnTagged);
     RTTI_METHOD(AttachTagged);
     RTTI_METHOD(DetachTagged);
+
+    RTTI_METHOD(GetInRadius);
+    RTTI_METHOD(GetInBox);
+    RTTI_METHOD(GetNearestTagged);
 });
@@ -18,6 +18,9 @@ void App::WorldStateSystem::OnWorldAttached(Red::world::RuntimeScene*)
 void App::WorldStateSystem::OnAfterWorldDetach()
 {
     m_ready = false;
+
+    m_prefabNodePool.clear();
+    m_prefabVariantNode.Reset();
 }
 
 bool App::WorldStateSystem::IsReady()
@@ -79,3 +82,115 @@ void App::WorldStateSystem::TogglePrefabVariant(Red::NodeRef aNodeRef, Red::CNam
 
     m_questPhaseExecutor->ExecuteNode(resetNode);
 }
+
+void App::WorldStateSystem::ApplyWorldState(const Red::DynArray<WorldStateChange>& aChanges)
+{
+    Core::Vector<std::pair<Red::NodeRef, const WorldStateChange*>> communityChanges;
+    Core::Vector<Red::Handle<Red::questNodeDefinition>> prefabNodes;
+    Red::DynArray<Red::questTogglePrefabVariant_NodeTypeParams> variantParams;
+    Core::Map<uint64_t, uint32_t> variantParamIndex;
+
+    for (const auto& change : aChanges)
+    {
+        switch (change.type)
+        {
+        case WorldStateChangeType::Community:
+        {
+            auto communityID = Red::ResolveNodeRef(change.nodeRef);
+
+            if (communityID)
+            {
+                communityChanges.emplace_back(communityID, &change);
+            }
+            break;
+        }
+        case WorldStateChangeType::Prefab:
+        {
+            prefabNodes.push_back(AcquirePrefabNode(prefabNodes.size(), change.nodeRef, change.state));
+            break;
+        }
+        case WorldStateChangeType::PrefabVariant:
+        {
+            Red::questVariantState variantState;
+            variantState.name = change.name;
+            variantState.show = change.state;
+
+            auto [paramIt, inserted] = variantParamIndex.emplace(change.nodeRef.hash, variantParams.size);
+
+            if (inserted)
+            {
+                Red::questTogglePrefabVariant_NodeTypeParams variantParam{};
+                variantParam.prefabNodeRef = change.nodeRef;
+                variantParams.PushBack(variantParam);
+            }
+
+            variantParams[paramIt->second].variantStates.PushBack(variantState);
+            break;
+        }
+        }
+    }
+
+    if (!communityChanges.empty())
+    {
+        for (const auto& [communityID, change] : communityChanges)
+        {
+            if (change->state)
+            {
+                Raw::CommunitySystem::ActivateCommunity(m_communitySystem, communityID, change->name);
+            }
+            else
+            {
+                Raw::CommunitySystem::DeactivateCommunity(m_communitySystem, communityID, change->name);
+            }
+        }
+
+        Raw::CommunitySystem::Update(m_communitySystem, true);
+    }
+
+    if (variantParams.size > 0)
+    {
+        prefabNodes.push_back(AcquirePrefabVariantNode(variantParams));
+    }
+
+    if (!prefabNodes.empty())
+    {
+        m_questPhaseExecutor->ExecuteNodes(prefabNodes);
+    }
+}
+
+Red::Handle<Red::questNodeDefinition> App::WorldStateSystem::AcquirePrefabNode(uint32_t aIndex,
+                                                                              Red::NodeRef aNodeRef, bool aState)
+{
+    if (aIndex == m_prefabNodePool.size())
+    {
+        auto resetNode = Red::MakeHandle<Red::questWorldDataManagerNodeDefinition>();
+        resetNode->id = 0;
+        resetNode->type = Red::MakeHandle<Red::questShowWorldNode_NodeType>();
+
+        m_prefabNodePool.push_back(std::move(resetNode));
+    }
+
+    auto& resetNode = m_prefabNodePool[aIndex];
+    auto* resetNodeType = static_cast<Red::questShowWorldNode_NodeType*>(resetNode->type.instance);
+    resetNodeType->objectRef = aNodeRef;
+    resetNodeType->show = aState;
+
+    return resetNode;
+}
+
+Red::Handle<Red::questNodeDefinition> App::WorldStateSystem::AcquirePrefabVariantNode(
+    Red::DynArray<Red::questTogglePrefabVariant_NodeTypeParams>& aParams)
+{
+    if (!m_prefabVariantNode)
+    {
+        m_prefabVariantNode = Red::MakeHandle<Red::questWorldDataManagerNodeDefinition>();
+        m_prefabVariantNode->id = 0;
+        m_prefabVariantNode->type = Red::MakeHandle<Red::questTogglePrefabVariant_NodeType>();
+    }
+
+    auto* resetNodeType = static_cast<Red::questTogglePrefabVariant_NodeType*>(
+        m_prefabVariantNode->type.instance);
+    resetNodeType->params = std::move(aParams);
+
+    return m_prefabVariantNode;
+}
@@ -5,6 +5,21 @@
 
 namespace App
 {
+enum class WorldStateChangeType : uint32_t
+{
+    Community,
+    Prefab,
+    PrefabVariant,
+};
+
+struct WorldStateChange
+{
+    WorldStateChangeType type;
+    Red::NodeRef nodeRef;
+    Red::CName name;
+    bool state;
+};
+
 class WorldStateSystem : public Red::IGameSystem
 {
 public:
@@ -16,10 +31,16 @@ public:
     void TogglePrefab(Red::NodeRef aNodeRef, bool aState);
     void TogglePrefabVariant(Red::NodeRef aNodeRef, Red::CName aVariant, bool aState);
 
+    void ApplyWorldState(const Red::DynArray<WorldStateChange>& aChanges);
+
 private:
     void OnWorldAttached(Red::world::RuntimeScene*) override;
     void OnAfterWorldDetach() override;
 
+    Red::Handle<Red::questNodeDefinition> AcquirePrefabNode(uint32_t aIndex, Red::NodeRef aNodeRef, bool aState);
+    Red::Handle<Red::questNodeDefinition> AcquirePrefabVariantNode(
+        Red::DynArray<Red::questTogglePrefabVariant_NodeTypeParams>& aParams);
+
     bool m_ready;
 
     Core::SharedPtr<QuestPhaseRegistry> m_questPhaseRegistry;
@@ -29,15 +50,28 @@ private:
     Red::questIQuestsSystem* m_questsSystem;
     Red::FactManager* m_factManager;
 
+    Core::Vector<Red::Handle<Red::questWorldDataManagerNodeDefinition>> m_prefabNodePool;
+    Red::Handle<Red::questWorldDataManagerNodeDefinition> m_prefabVariantNode;
+
     RTTI_IMPL_TYPEINFO(App::WorldStateSystem);
     RTTI_IMPL_ALLOCATOR();
 };
 }
 
+RTTI_DEFINE_ENUM(App::WorldStateChangeType);
+
+RTTI_DEFINE_CLASS(App::WorldStateChange, {
+    RTTI_PROPERTY(type);
+    RTTI_PROPERTY(nodeRef);
+    RTTI_PROPERTY(name);
+    RTTI_PROPERTY(state);
+});
+
 RTTI_DEFINE_CLASS(App::WorldStateSystem, {
     RTTI_METHOD(IsReady);
     RTTI_METHOD(ActivateCommunity);
     RTTI_METHOD(DeactivateCommunity);
     RTTI_METHOD(TogglePrefab);
     RTTI_METHOD(TogglePrefabVariant);
+    RTTI_METHOD(ApplyWorldState);
 });
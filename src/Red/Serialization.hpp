@@ -105,21 +105,54 @@ namespace Red
 {
 struct ObjectSerializer
 {
-    template<class T>
-    inline static void SaveToFile(const Red::Handle<T>& aObject, const std::filesystem::path& aPath)
+    static constexpr uint32_t MagicSizeLimit = 1337;
+
+    inline static void InstallHooks()
     {
-        constexpr uint32_t MagicSizeLimit = 1337;
-
-        Core::Hook::Before<Raw::ObjectSerializer::Prepare>(+[](void*, Red::ObjectSerializerParams* aParams) {
-            if (aParams->sizeLimit == MagicSizeLimit)
-            {
-                aParams->sizeLimit = 0;
-                aParams->flags = 0x10000000;
-            }
+        static std::once_flag s_installed;
+        std::call_once(s_installed, []() {
+            Core::Hook::Before<Raw::ObjectSerializer::Prepare>(+[](void*, Red::ObjectSerializerParams* aParams) {
+                if (aParams->sizeLimit == MagicSizeLimit)
+                {
+                    aParams->sizeLimit = 0;
+                    aParams->flags = 0x10000000;
+                }
+            });
         });
+    }
+
+    template<class T>
+    inline static void WriteToBuffer(const Red::Handle<T>& aObject, Red::DataBuffer& aBuffer)
+    {
+        InstallHooks();
 
+        Raw::ObjectSerializer::WriteObject(aBuffer, aObject, 0, MagicSizeLimit);
+    }
+
+    template<class T>
+    inline static void ReadFromMemory(Red::Handle<T>& aObject, const void* aData, uint32_t aSize,
+                                      uint32_t aAlignment)
+    {
+        auto allocator = Red::RawBuffer::AllocatorType::Get();
+        Red::DataBuffer buffer;
+
+        buffer.buffer.size = aSize;
+        buffer.buffer.alignment = aAlignment;
+        buffer.buffer.data = allocator->AllocAligned(aSize, aAlignment).memory;
+
+        std::memcpy(buffer.buffer.data, aData, aSize);
+
+        Red::DataBufferProxyStream stream(buffer);
+        Raw::ObjectSerializer::ReadObject(aObject, stream, Red::GetClass<T>());
+
+        allocator->Free(buffer.buffer.data);
+    }
+
+    template<class T>
+    inline static void SaveToFile(const Red::Handle<T>& aObject, const std::filesystem::path& aPath)
+    {
         Red::DataBuffer buffer;
-        Raw::ObjectSerializer::WriteObject(buffer, aObject, 0, MagicSizeLimit);
+        WriteToBuffer(aObject, buffer);
 
         std::ofstream out(aPath, std::ios::binary);
         out.write(reinterpret_cast<char*>(&buffer.buffer.size), sizeof(buffer.buffer.size));
@@ -34,9 +34,11 @@ inline void AppendToFlat(TweakDBID aRecordID, const char* aProp, const Core::Vec
         return;
 
     auto copy = *reinterpret_cast<DynArray<T>*>(data.value);
+    Core::Set<T> index(copy.begin(), copy.end());
+
     for (const auto& value : aValues)
     {
-        if (!copy.Contains(value))
+        if (index.insert(value).second)
         {
             copy.PushBack(value);
         }
@@ -71,6 +73,198 @@ inline void UpdateRecord(TweakDBID aRecordID)
     tweakDB->UpdateRecord(aRecordID);
 }
 
+// Stages flat creations, array appends and record creations, and applies them in one go.
+// Flat values are created on commit, the flats are inserted under a single lock,
+// then new records are created and each touched existing record is updated once.
+class TweakDBBatch
+{
+public:
+    TweakDBBatch() = default;
+    ~TweakDBBatch() = default;
+
+    TweakDBBatch(const TweakDBBatch&) = delete;
+    TweakDBBatch& operator=(const TweakDBBatch&) = delete;
+
+    template<typename T>
+    TweakDBID CreateFlat(TweakDBID aRecordID, const char* aProp, const T& aValue)
+    {
+        auto value = Core::MakeShared<T>(aValue);
+        auto& flat = StageFlat(TweakDBID(aRecordID, aProp));
+        flat.type = GetType<T>();
+        flat.data = value.get();
+        flat.storage = std::move(value);
+        flat.append = false;
+
+        return flat.flatID;
+    }
+
+    template<typename T>
+    bool AppendToFlat(TweakDBID aRecordID, const char* aProp, const Core::Vector<T>& aValues)
+    {
+        const auto flatID = TweakDBID(aRecordID, aProp);
+
+        auto appendIt = m_appends.find(flatID);
+        if (appendIt == m_appends.end())
+        {
+            auto append = Core::MakeShared<ArrayAppend<T>>();
+
+            auto* flat = TweakDB::Get()->GetFlatValue(flatID);
+            if (!flat)
+                return false;
+
+            auto data = flat->GetValue();
+
+            if (data.type->GetType() != ERTTIType::Array)
+                return false;
+
+            append->values = *reinterpret_cast<DynArray<T>*>(data.value);
+            append->index.insert(append->values.begin(), append->values.end());
+
+            auto& staged = StageFlat(flatID);
+            staged.type = data.type;
+            staged.data = &append->values;
+            staged.storage = append;
+            staged.append = true;
+
+            appendIt = m_appends.emplace(flatID, std::move(append)).first;
+
+            m_updates.insert(aRecordID);
+        }
+
+        auto* append = reinterpret_cast<ArrayAppend<T>*>(appendIt.value().get());
+
+        for (const auto& value : aValues)
+        {
+            if (append->index.insert(value).second)
+            {
+                append->values.PushBack(value);
+            }
+        }
+
+        return true;
+    }
+
+    void CreateRecord(TweakDBID aRecordID, const char* aType)
+    {
+        if (m_recordIDs.insert(aRecordID).second)
+        {
+            m_records.push_back({aRecordID, Murmur3_32(reinterpret_cast<const uint8_t*>(aType), strlen(aType))});
+        }
+    }
+
+    void UpdateRecord(TweakDBID aRecordID)
+    {
+        m_updates.insert(aRecordID);
+    }
+
+    [[nodiscard]] bool IsEmpty() const
+    {
+        return m_flats.empty() && m_records.empty() && m_updates.empty();
+    }
+
+    void Commit()
+    {
+        if (IsEmpty())
+            return;
+
+        auto tweakDB = TweakDB::Get();
+
+        for (auto& flat : m_flats)
+        {
+            flat.flatID.SetTDBOffset(tweakDB->CreateFlatValue({flat.type, flat.data}));
+        }
+
+        if (!m_flats.empty())
+        {
+            std::lock_guard _(tweakDB->mutex00);
+
+            // New flats don't replace existing ones, same as TweakDB::AddFlat,
+            // appends replace the existing array with the extended copy
+            for (const auto& flat : m_flats)
+            {
+                if (flat.append)
+                {
+                    tweakDB->flats.InsertOrAssign(flat.flatID);
+                }
+                else
+                {
+                    tweakDB->flats.Insert(flat.flatID);
+                }
+            }
+        }
+
+        using CreateTDBRecord_t = void (*)(TweakDB*, uint32_t, TweakDBID);
+        static UniversalRelocFunc<CreateTDBRecord_t> CreateTDBRecord(
+            RED4ext::Detail::AddressHashes::TweakDB_CreateRecord);
+
+        for (const auto& record : m_records)
+        {
+            CreateTDBRecord(tweakDB, record.typeHash, record.recordID);
+        }
+
+        for (const auto& recordID : m_updates)
+        {
+            if (!m_recordIDs.contains(recordID))
+            {
+                tweakDB->UpdateRecord(recordID);
+            }
+        }
+
+        m_flats.clear();
+        m_flatIndex.clear();
+        m_appends.clear();
+        m_records.clear();
+        m_recordIDs.clear();
+        m_updates.clear();
+    }
+
+private:
+    struct StagedFlat
+    {
+        TweakDBID flatID;
+        CBaseRTTIType* type;
+        void* data;
+        Core::SharedPtr<void> storage;
+        bool append;
+    };
+
+    struct StagedRecord
+    {
+        TweakDBID recordID;
+        uint32_t typeHash;
+    };
+
+    template<typename T>
+    struct ArrayAppend
+    {
+        DynArray<T> values;
+        Core::Set<T> index;
+    };
+
+    StagedFlat& StageFlat(TweakDBID aFlatID)
+    {
+        auto [flatIt, inserted] = m_flatIndex.emplace(aFlatID, m_flats.size());
+
+        if (inserted)
+        {
+            auto& flat = m_flats.emplace_back();
+            flat.flatID = aFlatID;
+            return flat;
+        }
+
+        m_appends.erase(aFlatID);
+
+        return m_flats[flatIt->second];
+    }
+
+    Core::Vector<StagedFlat> m_flats;
+    Core::Map<TweakDBID, size_t> m_flatIndex;
+    Core::Map<TweakDBID, Core::SharedPtr<void>> m_appends;
+    Core::Vector<StagedRecord> m_records;
+    Core::Set<TweakDBID> m_recordIDs;
+    Core::Set<TweakDBID> m_updates;
+};
+
 inline bool RecordExists(TweakDBID aRecordID)
 {
     auto tweakDB = Red::TweakDB::Get();
@@ -1,23 +1,31 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <codecvt>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <format>
 #include <fstream>
 #include <future>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ranges>
 #include <regex>
 #include <set>
+#include <shared_mutex>
 #include <source_location>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -81,6 +89,7 @@
 #include <RED4ext/Scripting/Natives/Generated/game/IHitShape.hpp>
 #include <RED4ext/Scripting/Natives/Generated/game/IJournalManager.hpp>
 #include <RED4ext/Scripting/Natives/Generated/game/IPersistencySystem.hpp>
+#include <RED4ext/Scripting/Natives/Generated/game/IPlayerSystem.hpp>
 #include <RED4ext/Scripting/Natives/Generated/game/IPopulationSystem.hpp>
 #include <RED4ext/Scripting/Natives/Generated/game/JournalEntry.hpp>
 #include <RED4ext/Scripting/Natives/Generated/game/JournalEntryState.hpp>
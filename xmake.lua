@@ -31,6 +31,12 @@ end
 
 add_requires("hopscotch-map", "minhook", "spdlog", "tiltedcore")
 
+option("bench")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Build the standalone benchmarks for engine independent code")
+option_end()
+
 target("Codeware")
     set_default(true)
     set_kind("shared")
@@ -49,6 +55,25 @@ target("Codeware")
     set_configvar("AUTHOR", "psiberx")
     set_configvar("NAME", "Codeware")
 
+if has_config("bench") then
+    target("Benchmarks")
+        set_default(false)
+        set_kind("binary")
+        set_group("bench")
+        set_pcxxheader("bench/pch.hpp")
+        add_files("bench/**.cpp")
+        add_files("src/App/Shared/ResourcePathPattern.cpp", "src/App/Shared/ResourcePathTable.cpp")
+        add_files("src/App/World/EntitySpatialIndex.cpp")
+        add_files("lib/Core/Facades/Runtime.cpp", "lib/Core/Logging/*.cpp", "lib/Core/Runtime/*.cpp")
+        add_files("lib/Support/Spdlog/SpdlogProvider.cpp")
+        add_headerfiles("bench/**.hpp")
+        add_includedirs("bench/", "src/", "lib/")
+        add_deps("RED4ext.SDK", "nameof", "wil")
+        add_packages("hopscotch-map", "spdlog", "tiltedcore")
+        add_syslinks("Version")
+        add_defines("WINVER=0x0601", "WIN32_LEAN_AND_MEAN", "NOMINMAX")
+end
+
 target("RED4ext.SDK")
     set_default(false)
     set_kind("static")